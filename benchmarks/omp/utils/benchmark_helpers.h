@@ -0,0 +1,20 @@
+#pragma once
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+
+// Container sizes from a few cache lines up to well past the last level cache.
+inline void container_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+// `size` elements numbered from 1.
+template <typename Container> Container make_container(std::size_t size) {
+  Container container(size);
+  std::iota(std::begin(container), std::end(container), 1);
+
+  return container;
+}
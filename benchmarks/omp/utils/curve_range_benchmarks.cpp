@@ -0,0 +1,116 @@
+#include "omp/utils/curve_range.h"
+#include "omp/utils/range.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+void curve_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+}
+
+template <typename Size>
+void transpose_bytes(benchmark::State &state, Size size) {
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(float) * size *
+                          size);
+}
+
+void curve_transpose_nested_range(benchmark::State &state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto i : omp::range(size))
+      for (auto j : omp::range(size))
+        out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  transpose_bytes(state, size);
+}
+
+void curve_transpose_morton(benchmark::State &state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto [i, j] : omp::morton_range({size, size}))
+      out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  transpose_bytes(state, size);
+}
+
+void curve_transpose_hilbert(benchmark::State &state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto [i, j] : omp::hilbert_range({size, size}))
+      out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  transpose_bytes(state, size);
+}
+
+// Five-point stencil reading the transposed neighbourhood, so both the rows
+// and the columns of the input are touched.
+template <typename Visit>
+void stencil(benchmark::State &state, int size, Visit &&visit) {
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    visit([&](int i, int j) {
+      if (i == 0 || j == 0 || i == size - 1 || j == size - 1)
+        return;
+
+      out[j * size + i] = in[i * size + j] + in[(i - 1) * size + j] +
+                          in[(i + 1) * size + j] + in[i * size + j - 1] +
+                          in[i * size + j + 1];
+    });
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  transpose_bytes(state, size);
+}
+
+void curve_stencil_nested_range(benchmark::State &state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  stencil(state, size, [&](auto &&body) {
+    for (auto i : omp::range(size))
+      for (auto j : omp::range(size))
+        body(i, j);
+  });
+}
+
+void curve_stencil_hilbert(benchmark::State &state) {
+  const auto size = static_cast<int>(state.range(0));
+
+  stencil(state, size, [&](auto &&body) {
+    for (auto [i, j] : omp::hilbert_range({size, size}))
+      body(i, j);
+  });
+}
+} // namespace
+
+BENCHMARK(curve_transpose_nested_range)->Apply(curve_arguments);
+BENCHMARK(curve_transpose_morton)->Apply(curve_arguments);
+BENCHMARK(curve_transpose_hilbert)->Apply(curve_arguments);
+BENCHMARK(curve_stencil_nested_range)->Apply(curve_arguments);
+BENCHMARK(curve_stencil_hilbert)->Apply(curve_arguments);
@@ -0,0 +1,104 @@
+#include "omp/utils/enumerate.h"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <vector>
+
+namespace {
+template <typename Container> void enumerate_raw_loop(benchmark::State &state) {
+  const auto container =
+      make_container<Container>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    std::ptrdiff_t idx = 0;
+    long long sum = 0;
+
+    for (const auto &value : container)
+      sum += idx++ * value;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void enumerate_omp_enumerate(benchmark::State &state) {
+  const auto container =
+      make_container<Container>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    long long sum = 0;
+
+    for (auto [idx, value] : omp::enumerate(container))
+      sum += idx * value;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void enumerate_index_loop_write(benchmark::State &state) {
+  std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (std::size_t idx = 0; idx < values.size(); ++idx)
+      values[idx] = static_cast<float>(idx) * 0.5f;
+
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void enumerate_omp_enumerate_write(benchmark::State &state) {
+  std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (auto [idx, value] : omp::enumerate(values))
+      value = static_cast<float>(idx) * 0.5f;
+
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void enumerate_omp_enumerate_int32_write(benchmark::State &state) {
+  std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    for (auto [idx, value] : omp::enumerate<std::int32_t>(values))
+      value = static_cast<float>(idx) * 0.5f;
+
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(enumerate_raw_loop, std::vector<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(enumerate_omp_enumerate, std::vector<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(enumerate_raw_loop, std::deque<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(enumerate_omp_enumerate, std::deque<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(enumerate_raw_loop, std::list<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(enumerate_omp_enumerate, std::list<int>)
+    ->Apply(container_arguments);
+BENCHMARK(enumerate_index_loop_write)->Apply(container_arguments);
+BENCHMARK(enumerate_omp_enumerate_write)->Apply(container_arguments);
+BENCHMARK(enumerate_omp_enumerate_int32_write)->Apply(container_arguments);
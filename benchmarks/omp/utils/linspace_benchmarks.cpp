@@ -0,0 +1,52 @@
+#include "omp/utils/linspace.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+void linspace_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+}
+
+void sample_accumulating_loop(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto step = 1.0f / static_cast<float>(size - 1);
+
+  std::vector<float> y(size);
+
+  for (auto _ : state) {
+    auto x = 0.0f;
+
+    for (std::size_t i = 0; i < size; ++i, x += step)
+      y[i] = x * x + 1.0f;
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sample_omp_linspace(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> y(size);
+
+  for (auto _ : state) {
+    auto out = y.begin();
+
+    for (auto x : omp::linspace(0.0f, 1.0f, size))
+      *out++ = x * x + 1.0f;
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(sample_accumulating_loop)->Apply(linspace_arguments);
+BENCHMARK(sample_omp_linspace)->Apply(linspace_arguments);
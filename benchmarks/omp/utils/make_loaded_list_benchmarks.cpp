@@ -0,0 +1,131 @@
+#include "omp/utils/make_loaded_list.h"
+#include "omp/utils/reversed.h"
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace {
+void list_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+}
+
+// In-memory stand-in for a list interface: records are fetched one by one
+// through GetRecordByIndex, like the COM lists the wrapper is made for.
+struct memory_list {
+  explicit memory_list(std::size_t size) : records(size) {
+    std::iota(std::begin(records), std::end(records), 1);
+  }
+
+  void LoadDataList() {}
+
+  bool Count(long *count) {
+    *count = static_cast<long>(records.size());
+    return true;
+  }
+
+  bool GetRecordByCode(long code, long *value) {
+    return GetRecordByIndex(code, value);
+  }
+
+  bool GetRecordByIndex(long idx, long *value) {
+    *value = records[static_cast<std::size_t>(idx)];
+    return true;
+  }
+
+  std::vector<long> records;
+};
+
+void loaded_list_raw_loop(benchmark::State &state) {
+  auto list =
+      std::make_shared<memory_list>(static_cast<std::size_t>(state.range(0)));
+
+  list->LoadDataList();
+
+  for (auto _ : state) {
+    long count = 0;
+    list->Count(&count);
+
+    long long sum = 0;
+
+    for (long idx = 0; idx < count; ++idx) {
+      long value = 0;
+      list->GetRecordByIndex(idx, &value);
+
+      sum += value;
+    }
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void loaded_list_omp_wrapper(benchmark::State &state) {
+  auto list =
+      std::make_shared<memory_list>(static_cast<std::size_t>(state.range(0)));
+
+  const auto wrapper = omp::make_loaded_list(list);
+
+  for (auto _ : state) {
+    long long sum = 0;
+
+    for (auto value : wrapper)
+      sum += value;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void loaded_list_reversed_raw_loop(benchmark::State &state) {
+  auto list =
+      std::make_shared<memory_list>(static_cast<std::size_t>(state.range(0)));
+
+  list->LoadDataList();
+
+  for (auto _ : state) {
+    long count = 0;
+    list->Count(&count);
+
+    long long sum = 0;
+
+    for (long idx = count; idx-- > 0;) {
+      long value = 0;
+      list->GetRecordByIndex(idx, &value);
+
+      sum += value;
+    }
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void loaded_list_reversed_omp_wrapper(benchmark::State &state) {
+  auto list =
+      std::make_shared<memory_list>(static_cast<std::size_t>(state.range(0)));
+
+  const auto wrapper = omp::make_loaded_list(list);
+
+  for (auto _ : state) {
+    long long sum = 0;
+
+    for (auto value : omp::reversed(wrapper))
+      sum += value;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(loaded_list_raw_loop)->Apply(list_arguments);
+BENCHMARK(loaded_list_omp_wrapper)->Apply(list_arguments);
+BENCHMARK(loaded_list_reversed_raw_loop)->Apply(list_arguments);
+BENCHMARK(loaded_list_reversed_omp_wrapper)->Apply(list_arguments);
@@ -0,0 +1,72 @@
+#include "omp/utils/ndrange.h"
+#include "omp/utils/range.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+void transpose_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+}
+
+void transpose_nested_range(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto i : omp::range(size))
+      for (auto j : omp::range(size))
+        out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(float) * size *
+                          size);
+}
+
+void transpose_ndrange(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto [i, j] : omp::ndrange({size, size}))
+      out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(float) * size *
+                          size);
+}
+
+void transpose_ndrange_tiled(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto tile = static_cast<std::size_t>(state.range(1));
+
+  std::vector<float> in(size * size, 1.0f), out(size * size);
+
+  for (auto _ : state) {
+    for (auto block : omp::ndrange({size, size}).tiled({tile, tile}))
+      for (auto [i, j] : block)
+        out[j * size + i] = in[i * size + j];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(float) * size *
+                          size);
+}
+} // namespace
+
+BENCHMARK(transpose_nested_range)->Apply(transpose_arguments);
+BENCHMARK(transpose_ndrange)->Apply(transpose_arguments);
+BENCHMARK(transpose_ndrange_tiled)
+    ->ArgsProduct({benchmark::CreateRange(1 << 8, 1 << 12, 4), {16, 64}});
@@ -0,0 +1,127 @@
+#include "omp/utils/parallel.h"
+#include "omp/utils/range.h"
+#include "omp/utils/zip.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace {
+constexpr float parallel_saxpy_factor = 2.5f;
+
+void parallel_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->UseRealTime();
+}
+
+void parallel_saxpy_serial(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  for (auto _ : state) {
+    for (auto i : omp::range(size))
+      y[i] = parallel_saxpy_factor * x[i] + y[i];
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_saxpy_parallel_for(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  // Chunks instead of single indices keep the inner loop vectorized.
+  const auto chunks = omp::range(size).chunks(1 << 12);
+
+  for (auto _ : state) {
+    omp::parallel_for(chunks, [&](auto chunk) {
+      for (auto i : chunk)
+        y[i] = parallel_saxpy_factor * x[i] + y[i];
+    });
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_sum_serial(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<double> x(size, 1.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto i : omp::range(size))
+      sum += x[i];
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_sum_parallel_reduce(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<double> x(size, 1.0);
+
+  for (auto _ : state) {
+    auto sum = omp::parallel_reduce(x, 0.0, std::plus<>());
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_dot_serial(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<double> x(size, 1.0), y(size, 2.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto [first, second] : omp::zip(x, y))
+      sum += first * second;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void parallel_dot_parallel_transform_reduce(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<double> x(size, 1.0), y(size, 2.0);
+
+  for (auto _ : state) {
+    auto sum = omp::parallel_transform_reduce(
+        omp::zip(x, y), 0.0, std::plus<>(), [](auto element) {
+          auto [first, second] = element;
+          return first * second;
+        });
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(parallel_saxpy_serial)->Apply(parallel_arguments);
+BENCHMARK(parallel_saxpy_parallel_for)->Apply(parallel_arguments);
+BENCHMARK(parallel_sum_serial)->Apply(parallel_arguments);
+BENCHMARK(parallel_sum_parallel_reduce)->Apply(parallel_arguments);
+BENCHMARK(parallel_dot_serial)->Apply(parallel_arguments);
+BENCHMARK(parallel_dot_parallel_transform_reduce)->Apply(parallel_arguments);
@@ -0,0 +1,104 @@
+#include "omp/utils/prefetched.h"
+#include "omp/utils/zip.h"
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace {
+// Data far larger than the last level cache, prefetch distances from none
+// to well past the memory latency.
+void distance_arguments(benchmark::internal::Benchmark *bench) {
+  for (auto distance : {0, 2, 4, 8, 16, 32, 64, 128, 256})
+    bench->Args({1 << 24, distance});
+}
+
+std::vector<std::uint32_t> make_indices(std::size_t size) {
+  std::vector<std::uint32_t> indices(size);
+  std::iota(std::begin(indices), std::end(indices), 0u);
+  std::shuffle(std::begin(indices), std::end(indices), std::mt19937(42));
+
+  return indices;
+}
+
+void prefetched_gather_raw_loop(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto indices = make_indices(size);
+  const std::vector<double> data(size, 1.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto idx : indices)
+      sum += data[idx];
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void prefetched_gather_omp_prefetched(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto distance = static_cast<std::size_t>(state.range(1));
+  const auto indices = make_indices(size);
+  const std::vector<double> data(size, 1.0);
+
+  const auto target = [&data](std::uint32_t ahead) { return &data[ahead]; };
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto idx : omp::prefetched(indices, distance, target))
+      sum += data[idx];
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void prefetched_zip_raw_loop(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<double> lhs(size, 1.5), rhs(size, 2.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto [first, second] : omp::zip(lhs, rhs))
+      sum += first * second;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void prefetched_zip_omp_prefetched(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto distance = static_cast<std::size_t>(state.range(1));
+  const std::vector<double> lhs(size, 1.5), rhs(size, 2.0);
+
+  for (auto _ : state) {
+    double sum = 0.0;
+
+    for (auto [first, second] : omp::prefetched(omp::zip(lhs, rhs), distance))
+      sum += first * second;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(prefetched_gather_raw_loop)->Arg(1 << 24);
+BENCHMARK(prefetched_gather_omp_prefetched)->Apply(distance_arguments);
+BENCHMARK(prefetched_zip_raw_loop)->Arg(1 << 24);
+BENCHMARK(prefetched_zip_omp_prefetched)->Apply(distance_arguments);
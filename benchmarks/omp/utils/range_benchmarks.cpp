@@ -0,0 +1,104 @@
+#include "omp/utils/range.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+constexpr float saxpy_factor = 2.5f;
+
+void saxpy_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+}
+
+template <typename Integral> void saxpy_raw_loop(benchmark::State &state) {
+  const auto size = static_cast<Integral>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  for (auto _ : state) {
+    for (Integral i = 0; i < size; ++i)
+      y[i] = saxpy_factor * x[i] + y[i];
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Integral> void saxpy_omp_range(benchmark::State &state) {
+  const auto size = static_cast<Integral>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  for (auto _ : state) {
+    for (auto i : omp::range(size))
+      y[i] = saxpy_factor * x[i] + y[i];
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Integral>
+void saxpy_omp_range_step(benchmark::State &state) {
+  const auto size = static_cast<Integral>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  for (auto _ : state) {
+    for (auto i : omp::range(Integral{0}, size, Integral{2}))
+      y[i] = saxpy_factor * x[i] + y[i];
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+
+template <typename Integral>
+void saxpy_omp_range_batches(benchmark::State &state) {
+  const auto size = static_cast<Integral>(state.range(0));
+
+  std::vector<float> x(size, 1.0f), y(size, 2.0f);
+
+  for (auto _ : state) {
+    auto batches = omp::range(size).template batches<8>();
+
+    // All lanes are loaded before any is stored, so the compiler does not
+    // have to prove that x and y do not overlap to use vector registers.
+    for (const auto &batch : batches) {
+      float *out = y.data() + batch[0];
+      const float *in = x.data() + batch[0];
+
+      float lanes[8];
+
+      for (std::size_t lane = 0; lane < 8; ++lane)
+        lanes[lane] = saxpy_factor * in[lane] + out[lane];
+
+      for (std::size_t lane = 0; lane < 8; ++lane)
+        out[lane] = lanes[lane];
+    }
+
+    for (auto i : batches.tail())
+      y[i] = saxpy_factor * x[i] + y[i];
+
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(saxpy_raw_loop, int)->Apply(saxpy_arguments);
+BENCHMARK_TEMPLATE(saxpy_omp_range, int)->Apply(saxpy_arguments);
+BENCHMARK_TEMPLATE(saxpy_raw_loop, std::size_t)->Apply(saxpy_arguments);
+BENCHMARK_TEMPLATE(saxpy_omp_range, std::size_t)->Apply(saxpy_arguments);
+BENCHMARK_TEMPLATE(saxpy_omp_range_step, int)->Apply(saxpy_arguments);
+BENCHMARK_TEMPLATE(saxpy_omp_range_batches, int)->Apply(saxpy_arguments);
@@ -0,0 +1,59 @@
+#include "omp/utils/reversed.h"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <vector>
+
+namespace {
+template <typename Container> void reversed_raw_loop(benchmark::State &state) {
+  const auto container =
+      make_container<Container>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    long long sum = 0;
+    long long weight = 0;
+
+    for (auto iter = container.crbegin(); iter != container.crend(); ++iter)
+      sum += ++weight * *iter;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container>
+void reversed_omp_reversed(benchmark::State &state) {
+  const auto container =
+      make_container<Container>(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    long long sum = 0;
+    long long weight = 0;
+
+    for (auto value : omp::reversed(container))
+      sum += ++weight * value;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(reversed_raw_loop, std::vector<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(reversed_omp_reversed, std::vector<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(reversed_raw_loop, std::deque<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(reversed_omp_reversed, std::deque<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(reversed_raw_loop, std::list<int>)
+    ->Apply(container_arguments);
+BENCHMARK_TEMPLATE(reversed_omp_reversed, std::list<int>)
+    ->Apply(container_arguments);
@@ -0,0 +1,127 @@
+#include "omp/utils/soa_vector.h"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace {
+struct particle {
+  float x, y, z;
+  float vx, vy, vz;
+  float mass;
+  int id;
+};
+
+void soa_vector_aos_column_sum(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<particle> particles(size, {0, 0, 0, 0, 0, 0, 1.5f, 0});
+
+  for (auto _ : state) {
+    float mass = 0;
+
+    for (const auto &item : particles)
+      mass += item.mass;
+
+    benchmark::DoNotOptimize(mass);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_vector_soa_column_sum(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  omp::soa_vector<float, float, float, float, float, float, float, int>
+      particles;
+  particles.resize(size, 0, 0, 0, 0, 0, 0, 1.5f, 0);
+
+  for (auto _ : state) {
+    const auto masses = particles.column<6>();
+
+    benchmark::DoNotOptimize(
+        std::accumulate(std::begin(masses), std::end(masses), 0.0f));
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_vector_aos_integrate(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<particle> particles(size, {0, 0, 0, 1, 2, 3, 1.5f, 0});
+
+  for (auto _ : state) {
+    for (auto &item : particles) {
+      item.x += item.vx;
+      item.y += item.vy;
+      item.z += item.vz;
+    }
+
+    benchmark::DoNotOptimize(particles.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_vector_soa_integrate(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  omp::soa_vector<float, float, float, float, float, float, float, int>
+      particles;
+  particles.resize(size, 0, 0, 0, 1, 2, 3, 1.5f, 0);
+
+  for (auto _ : state) {
+    for (auto [x, y, z, vx, vy, vz, mass, id] : particles) {
+      x += vx;
+      y += vy;
+      z += vz;
+    }
+
+    benchmark::DoNotOptimize(particles.column<0>().data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_vector_emplace_back_records(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<particle> particles(size, {0, 0, 0, 1, 2, 3, 1.5f, 0});
+
+  for (auto _ : state) {
+    omp::soa_vector_of_t<particle> soa;
+    soa.reserve(size);
+
+    for (const auto &item : particles)
+      soa.emplace_back(item.x, item.y, item.z, item.vx, item.vy, item.vz,
+                       item.mass, item.id);
+
+    benchmark::DoNotOptimize(soa.column<0>().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void soa_vector_aos_to_soa(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<particle> particles(size, {0, 0, 0, 1, 2, 3, 1.5f, 0});
+
+  for (auto _ : state) {
+    auto soa = omp::aos_to_soa(particles);
+
+    benchmark::DoNotOptimize(soa.column<0>().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(soa_vector_aos_column_sum)->Apply(container_arguments);
+BENCHMARK(soa_vector_soa_column_sum)->Apply(container_arguments);
+BENCHMARK(soa_vector_aos_integrate)->Apply(container_arguments);
+BENCHMARK(soa_vector_soa_integrate)->Apply(container_arguments);
+BENCHMARK(soa_vector_emplace_back_records)->Apply(container_arguments);
+BENCHMARK(soa_vector_aos_to_soa)->Apply(container_arguments);
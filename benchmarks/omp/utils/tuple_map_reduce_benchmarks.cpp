@@ -0,0 +1,63 @@
+#include "omp/utils/tuple_map_reduce.h"
+
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace {
+// Rows are a cache line each, so the largest size stops at 4 MiB: the fold
+// shapes are compared on arithmetic, not on memory bandwidth.
+void row_arguments(benchmark::internal::Benchmark *bench) {
+  bench->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+}
+
+using row = std::array<double, 8>;
+
+std::vector<row> make_rows(std::size_t size) {
+  std::vector<row> rows(size);
+
+  for (auto &values : rows)
+    for (std::size_t idx = 0; idx < values.size(); ++idx)
+      values[idx] = 0.5 * static_cast<double>(idx);
+
+  return rows;
+}
+
+// Row sums: the left fold is a chain of dependent additions, the tree has
+// independent additions on every level.
+void tuple_reduce_row_sums(benchmark::State &state) {
+  const auto rows = make_rows(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> sums(rows.size());
+
+  for (auto _ : state) {
+    for (std::size_t idx = 0; idx < rows.size(); ++idx)
+      sums[idx] = omp::tuple_reduce(std::plus<>(), 0.0, rows[idx]);
+
+    benchmark::DoNotOptimize(sums.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void tuple_reduce_tree_row_sums(benchmark::State &state) {
+  const auto rows = make_rows(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> sums(rows.size());
+
+  for (auto _ : state) {
+    for (std::size_t idx = 0; idx < rows.size(); ++idx)
+      sums[idx] = omp::tuple_reduce_tree(std::plus<>(), rows[idx]);
+
+    benchmark::DoNotOptimize(sums.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(tuple_reduce_row_sums)->Apply(row_arguments);
+BENCHMARK(tuple_reduce_tree_row_sums)->Apply(row_arguments);
@@ -0,0 +1,58 @@
+#include "omp/utils/unzip.h"
+#include "omp/utils/zip.h"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace {
+// The approach unzip replaces: materialize the records, then copy every
+// column out of them.
+void unzip_tuple_vector(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_container<std::vector<int>>(size);
+  const auto values = make_container<std::vector<double>>(size);
+
+  for (auto _ : state) {
+    std::vector<std::tuple<int, double>> records;
+
+    for (auto [key, value] : omp::zip(keys, values))
+      records.emplace_back(key, value);
+
+    std::vector<int> out_keys;
+    std::vector<double> out_values;
+
+    for (const auto &record : records) {
+      out_keys.push_back(std::get<0>(record));
+      out_values.push_back(std::get<1>(record));
+    }
+
+    benchmark::DoNotOptimize(out_keys.data());
+    benchmark::DoNotOptimize(out_values.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void unzip_omp_unzip(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_container<std::vector<int>>(size);
+  const auto values = make_container<std::vector<double>>(size);
+
+  for (auto _ : state) {
+    auto [out_keys, out_values] =
+        omp::unzip<std::vector>(omp::zip(keys, values));
+
+    benchmark::DoNotOptimize(out_keys.data());
+    benchmark::DoNotOptimize(out_values.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(unzip_tuple_vector)->Apply(container_arguments);
+BENCHMARK(unzip_omp_unzip)->Apply(container_arguments);
@@ -0,0 +1,92 @@
+#include "omp/utils/zip.h"
+
+#include "benchmark/benchmark.h"
+#include "benchmark_helpers.h"
+
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <vector>
+
+namespace {
+template <typename Container> void zip_raw_loop(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto lhs = make_container<Container>(size);
+  const auto rhs = make_container<Container>(size);
+
+  for (auto _ : state) {
+    long long sum = 0;
+
+    auto first = std::cbegin(lhs);
+    auto second = std::cbegin(rhs);
+
+    for (; first != std::cend(lhs) && second != std::cend(rhs);
+         ++first, ++second)
+      sum += *first * *second;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Container> void zip_omp_zip(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto lhs = make_container<Container>(size);
+  const auto rhs = make_container<Container>(size);
+
+  for (auto _ : state) {
+    long long sum = 0;
+
+    for (auto [first, second] : omp::zip(lhs, rhs))
+      sum += first * second;
+
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void zip_index_loop_multiply(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> out(size);
+  const std::vector<float> lhs(size, 1.5f), rhs(size, 2.0f);
+
+  for (auto _ : state) {
+    for (std::size_t idx = 0; idx < size; ++idx)
+      out[idx] = lhs[idx] * rhs[idx];
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void zip_omp_zip_multiply(benchmark::State &state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+
+  std::vector<float> out(size);
+  const std::vector<float> lhs(size, 1.5f), rhs(size, 2.0f);
+
+  for (auto _ : state) {
+    for (auto [o, l, r] : omp::zip(out, lhs, rhs))
+      o = l * r;
+
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(zip_raw_loop, std::vector<int>)->Apply(container_arguments);
+BENCHMARK_TEMPLATE(zip_omp_zip, std::vector<int>)->Apply(container_arguments);
+BENCHMARK_TEMPLATE(zip_raw_loop, std::deque<int>)->Apply(container_arguments);
+BENCHMARK_TEMPLATE(zip_omp_zip, std::deque<int>)->Apply(container_arguments);
+BENCHMARK_TEMPLATE(zip_raw_loop, std::list<int>)->Apply(container_arguments);
+BENCHMARK_TEMPLATE(zip_omp_zip, std::list<int>)->Apply(container_arguments);
+BENCHMARK(zip_index_loop_multiply)->Apply(container_arguments);
+BENCHMARK(zip_omp_zip_multiply)->Apply(container_arguments);
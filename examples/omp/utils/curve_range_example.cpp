@@ -0,0 +1,40 @@
+#include "omp/utils/curve_range.h"
+
+#include <iostream>
+
+namespace {
+void morton_range_example() {
+  for (auto [i, j] : omp::morton_range({4, 4}))
+    std::cout << "(" << i << ", " << j << ") ";
+
+  std::cout << std::endl;
+}
+
+void hilbert_range_example() {
+  for (auto [i, j] : omp::hilbert_range({4, 4}))
+    std::cout << "(" << i << ", " << j << ") ";
+
+  std::cout << std::endl;
+}
+
+void split_curve_range_example() {
+  for (auto part : omp::hilbert_range({4, 4}).split(2)) {
+    for (auto [i, j] : part)
+      std::cout << "(" << i << ", " << j << ") ";
+
+    std::cout << "| ";
+  }
+
+  std::cout << std::endl;
+}
+} // namespace
+
+void curve_range_examples() {
+  std::cout << "curve_range examples\n";
+
+  morton_range_example();
+  hilbert_range_example();
+  split_curve_range_example();
+
+  std::cout << std::endl;
+}
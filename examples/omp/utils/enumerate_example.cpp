@@ -16,12 +16,26 @@ void enumerate_example() {
 
   std::cout << std::endl;
 }
+
+void enumerate_split_example() {
+  std::vector elements = {'a', 'b', 'c', 'd', 'e'};
+
+  for (auto part : omp::enumerate(elements).split(2)) {
+    for (auto [idx, element] : part)
+      std::cout << idx << ": " << element << " ";
+
+    std::cout << "| ";
+  }
+
+  std::cout << std::endl;
+}
 } // namespace
 
 void enumerate_examples() {
   std::cout << "enumerate examples\n";
 
   enumerate_example();
+  enumerate_split_example();
 
   std::cout << std::endl;
 }
@@ -0,0 +1,28 @@
+#include "omp/utils/linspace.h"
+
+#include <iostream>
+
+namespace {
+void simple_linspace_example() {
+  for (auto value : omp::linspace(0.0, 1.0, 5))
+    std::cout << value << " ";
+
+  std::cout << std::endl;
+}
+
+void simple_arange_example() {
+  for (auto value : omp::arange(1.0, 1.3, 0.1))
+    std::cout << value << " ";
+
+  std::cout << std::endl;
+}
+} // namespace
+
+void linspace_examples() {
+  std::cout << "linspace examples\n";
+
+  simple_linspace_example();
+  simple_arange_example();
+
+  std::cout << std::endl;
+}
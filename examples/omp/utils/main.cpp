@@ -1,19 +1,33 @@
 
 
 extern void common_examples();
+extern void curve_range_examples();
 extern void enumerate_examples();
 extern void in_examples();
+extern void linspace_examples();
 extern void make_loaded_list_examples();
+extern void ndrange_examples();
+extern void parallel_examples();
+extern void prefetched_examples();
 extern void range_examples();
 extern void reversed_examples();
+extern void soa_vector_examples();
+extern void static_range_examples();
 
 int main() {
   common_examples();
+  curve_range_examples();
   enumerate_examples();
   in_examples();
+  linspace_examples();
   make_loaded_list_examples();
+  ndrange_examples();
+  parallel_examples();
+  prefetched_examples();
   range_examples();
   reversed_examples();
+  soa_vector_examples();
+  static_range_examples();
 
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "omp/utils/ndrange.h"
+
+#include <iostream>
+
+namespace {
+void simple_ndrange_example() {
+  for (auto [i, j] : omp::ndrange({2, 3}))
+    std::cout << "(" << i << ", " << j << ") ";
+
+  std::cout << std::endl;
+}
+
+void tiled_ndrange_example() {
+  for (auto tile : omp::ndrange({4, 4}).tiled({2, 2})) {
+    for (auto [i, j] : tile)
+      std::cout << "(" << i << ", " << j << ") ";
+
+    std::cout << "| ";
+  }
+
+  std::cout << std::endl;
+}
+
+void linear_ndrange_example() {
+  auto grid = omp::ndrange({3, 4});
+
+  for (auto part : grid.linear().split(2)) {
+    auto [i, j] = grid[*part.begin()];
+
+    std::cout << part.size() << " elements from (" << i << ", " << j << ") ";
+  }
+
+  std::cout << std::endl;
+}
+} // namespace
+
+void ndrange_examples() {
+  std::cout << "ndrange examples\n";
+
+  simple_ndrange_example();
+  tiled_ndrange_example();
+  linear_ndrange_example();
+
+  std::cout << std::endl;
+}
@@ -0,0 +1,75 @@
+#include "omp/utils/parallel.h"
+#include "omp/utils/range.h"
+#include "omp/utils/zip.h"
+
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace {
+void parallel_for_example() {
+  std::vector<int> squares(10);
+
+  omp::parallel_for(omp::range(squares.size()),
+                    [&](std::size_t i) { squares[i] = int(i * i); });
+
+  for (auto value : squares)
+    std::cout << value << " ";
+
+  std::cout << std::endl;
+}
+
+void parallel_reduce_example() {
+  auto sum = omp::parallel_reduce(omp::range(1, 101), 0, std::plus<>());
+
+  std::cout << sum << std::endl;
+}
+
+void parallel_transform_reduce_example() {
+  std::vector<double> prices = {1.5, 2.0, 4.0};
+  std::vector<int> amounts = {2, 1, 3};
+
+  auto total = omp::parallel_transform_reduce(
+      omp::zip(prices, amounts), 0.0, std::plus<>(), [](auto item) {
+        auto [price, amount] = item;
+        return price * amount;
+      });
+
+  std::cout << total << std::endl;
+}
+
+void parallel_tuple_map_example() {
+  const auto jobs = std::make_tuple(omp::range(1, 101), omp::range(0, 100, 7));
+
+  auto sums = omp::parallel_tuple_map(
+      [](const auto &numbers) {
+        return std::accumulate(numbers.begin(), numbers.end(), 0);
+      },
+      jobs);
+
+  std::cout << std::get<0>(sums) << " " << std::get<1>(sums) << std::endl;
+}
+
+void thread_pool_example() {
+  omp::thread_pool pool(2);
+
+  auto sum = omp::parallel_reduce(pool, omp::range(0, 100, 7), 0,
+                                  std::plus<>(), 4);
+
+  std::cout << sum << std::endl;
+}
+} // namespace
+
+void parallel_examples() {
+  std::cout << "parallel examples\n";
+
+  parallel_for_example();
+  parallel_reduce_example();
+  parallel_transform_reduce_example();
+  parallel_tuple_map_example();
+  thread_pool_example();
+
+  std::cout << std::endl;
+}
@@ -0,0 +1,44 @@
+#include "omp/utils/prefetched.h"
+#include "omp/utils/zip.h"
+
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+namespace {
+void prefetched_example() {
+  std::vector<int> values = {1, 2, 3, 4, 5};
+
+  for (auto value : omp::prefetched(values, 2))
+    std::cout << value << " ";
+
+  std::cout << std::endl;
+}
+
+void prefetched_gather_example() {
+  std::vector<char> letters = {'a', 'b', 'c', 'd'};
+  std::vector<std::size_t> indices = {3, 0, 1, 2, 0};
+  std::vector<char> word(indices.size());
+
+  const auto target = [&](auto ahead) { return &letters[std::get<0>(ahead)]; };
+
+  for (auto [idx, letter] :
+       omp::prefetched(omp::zip(indices, word), 2, target))
+    letter = letters[idx];
+
+  for (auto letter : word)
+    std::cout << letter;
+
+  std::cout << std::endl;
+}
+} // namespace
+
+void prefetched_examples() {
+  std::cout << "prefetched examples\n";
+
+  prefetched_example();
+  prefetched_gather_example();
+
+  std::cout << std::endl;
+}
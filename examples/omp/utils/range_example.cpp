@@ -27,6 +27,22 @@ void step_range_example() {
 
   std::cout << std::endl;
 }
+
+void batches_range_example() {
+  auto batches = omp::range(10).batches<4>();
+
+  for (const auto &batch : batches) {
+    for (auto value : batch)
+      std::cout << value << " ";
+
+    std::cout << "| ";
+  }
+
+  for (auto value : batches.tail())
+    std::cout << value << " ";
+
+  std::cout << std::endl;
+}
 } // namespace
 
 void range_examples() {
@@ -35,6 +51,7 @@ void range_examples() {
   simple_range_example();
   iterators_range_example();
   step_range_example();
+  batches_range_example();
 
   std::cout << std::endl;
 }
@@ -0,0 +1,37 @@
+#include "omp/utils/soa_vector.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+namespace {
+void soa_vector_example() {
+  omp::soa_vector<std::string, double> prices;
+
+  prices.push_back("pear", 2.5);
+  prices.push_back("apple", 1.25);
+  prices.push_back("plum", 3.0);
+
+  std::sort(std::begin(prices), std::end(prices));
+
+  for (const auto &[name, price] : prices)
+    std::cout << name << ": " << price << " ";
+
+  std::cout << std::endl;
+
+  auto column = prices.column<1>();
+
+  std::cout << "total: "
+            << std::accumulate(std::begin(column), std::end(column), 0.0)
+            << std::endl;
+}
+} // namespace
+
+void soa_vector_examples() {
+  std::cout << "soa_vector examples\n";
+
+  soa_vector_example();
+
+  std::cout << std::endl;
+}
@@ -0,0 +1,45 @@
+#include "omp/utils/static_range.h"
+#include "omp/utils/tuple_map_reduce.h"
+
+#include <iostream>
+#include <tuple>
+
+namespace {
+void simple_static_range_example() {
+  omp::static_range<0, 4>::for_each(
+      [](auto idx) { std::cout << idx << " "; });
+
+  std::cout << std::endl;
+}
+
+void tuple_static_range_example() {
+  auto values = std::make_tuple(1, 2.5, 'c');
+
+  omp::static_range<0, std::tuple_size_v<decltype(values)>>::for_each(
+      [&](auto idx) {
+        std::cout << idx << ":" << std::get<idx>(values) << " ";
+      });
+
+  std::cout << std::endl;
+}
+
+void tuple_map_static_range_example() {
+  auto values = std::make_tuple(1, 2.5, 3);
+
+  auto weighted = omp::tuple_reduce(
+      [](auto sum, auto idx, const auto &value) { return sum + idx * value; },
+      0.0, omp::static_range<0, 3>(), values);
+
+  std::cout << weighted << std::endl;
+}
+} // namespace
+
+void static_range_examples() {
+  std::cout << "static_range examples\n";
+
+  simple_static_range_example();
+  tuple_static_range_example();
+  tuple_map_static_range_example();
+
+  std::cout << std::endl;
+}
@@ -0,0 +1,305 @@
+#pragma once
+
+#include "range.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__BMI2__) && (defined(__x86_64__) || defined(_M_X64))
+#include <immintrin.h>
+#endif
+
+namespace omp {
+namespace details {
+
+// Gathers the even bits of `value` into the low half: 0b0a0b0c0d -> 0babcd.
+constexpr std::uint64_t compact_even_bits_portable_(std::uint64_t value) {
+  value &= 0x5555555555555555u;
+  value = (value | value >> 1) & 0x3333333333333333u;
+  value = (value | value >> 2) & 0x0F0F0F0F0F0F0F0Fu;
+  value = (value | value >> 4) & 0x00FF00FF00FF00FFu;
+  value = (value | value >> 8) & 0x0000FFFF0000FFFFu;
+  value = (value | value >> 16) & 0x00000000FFFFFFFFu;
+
+  return value;
+}
+
+// Single PEXT instruction when the target has BMI2, the shift-and-mask ladder
+// above otherwise.
+inline std::uint64_t compact_even_bits_(std::uint64_t value) noexcept {
+#if defined(__BMI2__) && (defined(__x86_64__) || defined(_M_X64))
+  return _pext_u64(value, 0x5555555555555555u);
+#else
+  return compact_even_bits_portable_(value);
+#endif
+}
+
+// Z-order: the row takes the odd bits of the curve index, the column the even
+// ones, so every 2x2 block is visited row by row.
+struct morton_curve {
+  static std::array<std::uint64_t, 2> decode(std::uint64_t index,
+                                             unsigned) noexcept {
+    return {compact_even_bits_(index >> 1), compact_even_bits_(index)};
+  }
+};
+
+// Parity of the bits of `value` strictly above each bit position.
+constexpr std::uint64_t parity_above_(std::uint64_t value) {
+  value ^= value >> 1;
+  value ^= value >> 2;
+  value ^= value >> 4;
+  value ^= value >> 8;
+  value ^= value >> 16;
+  value ^= value >> 32;
+
+  return value >> 1;
+}
+
+// Hilbert order on a square of side 2^bits: consecutive curve indices are
+// always neighbours in the grid.
+//
+// Every level of the curve picks a quadrant from two index bits and then
+// transposes and/or mirrors everything below it. Both transformations are
+// involutions that commute, so the transformation a level sees is the parity
+// of the choices made above it. That turns the usual level-by-level loop into
+// a handful of word-wide bit operations with no dependency between levels.
+struct hilbert_curve {
+  static std::array<std::uint64_t, 2> decode(std::uint64_t index,
+                                             unsigned bits) noexcept {
+    const auto mask = (std::uint64_t{1} << bits) - 1;
+
+    const auto high = compact_even_bits_(index >> 1) & mask;
+    const auto low = (compact_even_bits_(index) ^ high) & mask;
+
+    const auto swap = parity_above_(~low & mask);
+    const auto flip = parity_above_(~low & high & mask);
+
+    const auto row = ((high & ~swap) | (low & swap)) ^ flip;
+    const auto col = ((low & ~swap) | (high & swap)) ^ flip;
+
+    return {row & mask, col & mask};
+  }
+};
+
+template <typename Integral, typename Curve> struct curve_range;
+
+// Carries its own copy of the curve_range, so it stays valid after the range
+// it came from is gone.
+template <typename Integral, typename Curve> struct curve_iterator {
+  using view = curve_range<Integral, Curve>;
+
+  using iterator_category = std::forward_iterator_tag;
+
+  using value_type = std::array<Integral, 2>;
+
+  using reference = value_type;
+  using pointer = const value_type *;
+
+  using difference_type = std::ptrdiff_t;
+
+  curve_iterator() noexcept = default;
+
+  curve_iterator(const view &owner, std::uint64_t index) noexcept
+      : view_(owner), index_(index) {
+    seek_();
+  }
+
+  reference operator*() const noexcept { return value_; }
+
+  pointer operator->() const noexcept { return &value_; }
+
+  curve_iterator &operator++() noexcept {
+    ++index_;
+    seek_();
+
+    return *this;
+  }
+
+  curve_iterator operator++(int) noexcept {
+    auto temp = *this;
+    ++(*this);
+
+    return temp;
+  }
+
+  bool operator==(const curve_iterator &rhs) const noexcept {
+    return index_ == rhs.index_;
+  }
+
+  bool operator!=(const curve_iterator &rhs) const noexcept {
+    return !(*this == rhs);
+  }
+
+private:
+  // Skips the curve indices that fall into the padding around the grid.
+  void seek_() noexcept {
+    while (index_ != view_->stop_ && !view_->decode_(index_, value_))
+      ++index_;
+  }
+
+private:
+  // Optional only so that the iterator stays default constructible.
+  std::optional<view> view_;
+  std::uint64_t index_{};
+  value_type value_{};
+};
+
+template <typename Integral, typename Curve> struct curve_partition;
+
+struct curve_segment_tag {};
+
+// Visits the grid [0, rows) x [0, cols) along a space-filling curve.
+//
+// Each extent is padded to a power of two. The curve is laid out on squares
+// whose side is the smaller padded extent, and the squares follow each other
+// along the longer dimension, so the padding is at most three quarters of the
+// curve even for elongated grids. Padded points are skipped while iterating.
+template <typename Integral, typename Curve> struct curve_range {
+  using value_type = std::array<Integral, 2>;
+
+  using iterator = curve_iterator<Integral, Curve>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(std::is_integral_v<Integral>, "Type is not integral");
+
+  explicit curve_range(const value_type &extents) : extents_(extents) {
+    if (extents_[0] <= Integral{0} || extents_[1] <= Integral{0})
+      return;
+
+    const auto row_bits = ceil_log2_(extents_[0]);
+    const auto col_bits = ceil_log2_(extents_[1]);
+
+    if (row_bits + col_bits >= 63)
+      throw std::logic_error("extents are too large");
+
+    bits_ = row_bits < col_bits ? row_bits : col_bits;
+    along_rows_ = row_bits > col_bits;
+    stop_ = std::uint64_t{1} << (row_bits + col_bits);
+  }
+
+  curve_range(const curve_range &whole, std::uint64_t start,
+              std::uint64_t stop, curve_segment_tag) noexcept
+      : curve_range(whole) {
+    start_ = start;
+    stop_ = stop;
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(*this, start_);
+  }
+
+  const_iterator end() const noexcept { return const_iterator(*this, stop_); }
+
+  const value_type &extents() const noexcept { return extents_; }
+
+  // Curve indices [first, last) covered by this range, padding included.
+  range<std::uint64_t> curve() const noexcept {
+    return range<std::uint64_t>(start_, stop_);
+  }
+
+  // Splits the curve into `parts` contiguous segments of equal curve length.
+  curve_partition<Integral, Curve> split(std::size_t parts) const {
+    return curve_partition<Integral, Curve>(*this, curve().split(parts));
+  }
+
+  // Splits the curve into contiguous segments of `grain` curve indices each.
+  curve_partition<Integral, Curve> chunks(std::size_t grain) const {
+    return curve_partition<Integral, Curve>(*this, curve().chunks(grain));
+  }
+
+private:
+  friend iterator;
+
+  static unsigned ceil_log2_(Integral extent) noexcept {
+    unsigned bits = 0;
+
+    while ((std::uint64_t{1} << bits) < static_cast<std::uint64_t>(extent))
+      ++bits;
+
+    return bits;
+  }
+
+  bool decode_(std::uint64_t index, value_type &value) const noexcept {
+    const auto square = bits_ * 2;
+    const auto block = index >> square;
+
+    auto cell = Curve::decode(index & ((std::uint64_t{1} << square) - 1),
+                              bits_);
+    cell[along_rows_ ? 0 : 1] += block << bits_;
+
+    if (cell[0] >= static_cast<std::uint64_t>(extents_[0]) ||
+        cell[1] >= static_cast<std::uint64_t>(extents_[1]))
+      return false;
+
+    value = {static_cast<Integral>(cell[0]), static_cast<Integral>(cell[1])};
+
+    return true;
+  }
+
+private:
+  value_type extents_;
+  unsigned bits_{};
+  bool along_rows_{};
+  std::uint64_t start_{};
+  std::uint64_t stop_{};
+};
+
+// Allocation-free view of contiguous curve segments, one per thread.
+template <typename Integral, typename Curve> struct curve_partition {
+  using value_type = curve_range<Integral, Curve>;
+
+  using iterator = indexed_view_iterator<curve_partition>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  curve_partition(const value_type &whole,
+                  const range_partition<std::uint64_t> &parts) noexcept
+      : whole_(whole), parts_(parts) {}
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(size()));
+  }
+
+  value_type operator[](std::size_t idx) const noexcept {
+    const auto segment = parts_[idx];
+
+    return value_type(whole_, *segment.begin(), *segment.end(),
+                      curve_segment_tag{});
+  }
+
+  bool empty() const noexcept { return parts_.empty(); }
+
+  std::size_t size() const noexcept { return parts_.size(); }
+
+private:
+  value_type whole_;
+  range_partition<std::uint64_t> parts_;
+};
+
+} // namespace details
+
+// Grid [0, rows) x [0, cols) in Morton (Z-order) order.
+template <typename Integral>
+auto morton_range(const Integral (&extents)[2]) {
+  return details::curve_range<Integral, details::morton_curve>(
+      {extents[0], extents[1]});
+}
+
+// Grid [0, rows) x [0, cols) in Hilbert order.
+template <typename Integral>
+auto hilbert_range(const Integral (&extents)[2]) {
+  return details::curve_range<Integral, details::hilbert_curve>(
+      {extents[0], extents[1]});
+}
+
+} // namespace omp
@@ -1,43 +1,105 @@
 #pragma once
 
 #include "base_container_traits.h"
+#include "range.h"
+
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace omp {
 namespace details {
 
-template <typename Iterator> struct enumerate_iterator {
+template <typename Iterator, typename Category>
+constexpr bool is_at_least_v = std::is_base_of_v<
+    Category, typename std::iterator_traits<Iterator>::iterator_category>;
+
+// The strongest of forward, bidirectional and random access that the wrapped
+// iterator supports.
+template <typename Iterator>
+using enumerate_category_t = std::conditional_t<
+    is_at_least_v<Iterator, std::random_access_iterator_tag>,
+    std::random_access_iterator_tag,
+    std::conditional_t<is_at_least_v<Iterator, std::bidirectional_iterator_tag>,
+                       std::bidirectional_iterator_tag,
+                       std::forward_iterator_tag>>;
+
+// What dereferencing an enumerate_iterator yields: the index and the
+// reference of the wrapped iterator side by side, nothing is copied. It binds
+// to `auto [idx, value]` through get<0>/get<1> and still reads like the pair
+// it stands for through `first` and `second`.
+template <typename Reference, typename Index = std::ptrdiff_t>
+struct enumerate_reference {
+  using pair_type = std::pair<const Index, Reference>;
+
+  template <std::size_t Idx> decltype(auto) get() const noexcept {
+    static_assert(Idx < 2, "Index is out of range");
+
+    if constexpr (Idx == 0)
+      return (first);
+    else
+      return static_cast<Reference>(second);
+  }
+
+  operator pair_type() const { return pair_type(first, second); }
+
+  const Index first;
+  Reference second;
+};
+
+template <std::size_t Idx, typename Reference, typename Index>
+decltype(auto)
+get(const enumerate_reference<Reference, Index> &element) noexcept {
+  return element.template get<Idx>();
+}
+
+template <typename Iterator, typename Index = std::ptrdiff_t>
+struct enumerate_iterator {
   using wrapped_iterator = Iterator;
 
-  using iterator_category = std::forward_iterator_tag;
+  using iterator_category = enumerate_category_t<wrapped_iterator>;
 
-  using value_type =
-      std::pair<const std::ptrdiff_t,
-                typename std::iterator_traits<wrapped_iterator>::reference>;
+  using wrapped_reference =
+      typename std::iterator_traits<wrapped_iterator>::reference;
+
+  using index_type = Index;
+
+  using value_type = std::pair<const index_type, wrapped_reference>;
 
   using difference_type = std::ptrdiff_t;
 
+  using reference = const enumerate_reference<wrapped_reference, index_type>;
+
   struct pointer {
-    explicit pointer(value_type &&value) noexcept : value_(std::move(value)) {}
+    explicit pointer(reference value) noexcept : value_(value) {}
 
-    value_type *operator->() noexcept { return &value_; }
+    const enumerate_reference<wrapped_reference, index_type> *
+    operator->() const noexcept {
+      return &value_;
+    }
 
-    value_type value_;
+    enumerate_reference<wrapped_reference, index_type> value_;
   };
 
-  using reference = const value_type;
+  enumerate_iterator() = default;
 
   explicit enumerate_iterator(
       wrapped_iterator &&iter,
-      std::ptrdiff_t
+      index_type
           value) noexcept(std::
                               is_nothrow_move_constructible_v<wrapped_iterator>)
       : iterator_(std::move(iter)), value_(value) {}
 
-  reference operator*() noexcept { return value_type(value_, *iterator_); }
+  reference operator*() const noexcept { return {value_, *iterator_}; }
+
+  pointer operator->() const noexcept { return pointer(**this); }
 
-  pointer operator->() noexcept {
-    return pointer(value_type(value_, *iterator_));
+  reference operator[](difference_type diff) const {
+    return {static_cast<index_type>(value_ + diff), iterator_[diff]};
   }
 
   enumerate_iterator &operator++() {
@@ -55,6 +117,53 @@ template <typename Iterator> struct enumerate_iterator {
     return tmp;
   }
 
+  enumerate_iterator &operator--() {
+    --iterator_;
+    --value_;
+
+    return *this;
+  }
+
+  enumerate_iterator operator--(int) {
+    auto tmp = *this;
+
+    --(*this);
+
+    return tmp;
+  }
+
+  enumerate_iterator &operator+=(difference_type diff) {
+    iterator_ += diff;
+    value_ = static_cast<index_type>(value_ + diff);
+
+    return *this;
+  }
+
+  enumerate_iterator operator+(difference_type diff) const {
+    auto tmp = *this;
+
+    return tmp += diff;
+  }
+
+  friend enumerate_iterator operator+(difference_type diff,
+                                      const enumerate_iterator &iter) {
+    return iter + diff;
+  }
+
+  enumerate_iterator &operator-=(difference_type diff) {
+    return *this += -diff;
+  }
+
+  enumerate_iterator operator-(difference_type diff) const {
+    auto tmp = *this;
+
+    return tmp -= diff;
+  }
+
+  difference_type operator-(const enumerate_iterator &rhs) const {
+    return static_cast<difference_type>(iterator_ - rhs.iterator_);
+  }
+
   bool operator==(const enumerate_iterator &rhs) const noexcept {
     return iterator_ == rhs.iterator_;
   }
@@ -63,10 +172,40 @@ template <typename Iterator> struct enumerate_iterator {
     return !(*this == rhs);
   }
 
+  bool operator<(const enumerate_iterator &rhs) const noexcept {
+    return iterator_ < rhs.iterator_;
+  }
+
+  bool operator>(const enumerate_iterator &rhs) const noexcept {
+    return rhs < *this;
+  }
+
+  bool operator<=(const enumerate_iterator &rhs) const noexcept {
+    return !(*this > rhs);
+  }
+
+  bool operator>=(const enumerate_iterator &rhs) const noexcept {
+    return !(*this < rhs);
+  }
+
   wrapped_iterator iterator_;
-  std::ptrdiff_t value_;
+  index_type value_;
+};
+
+template <typename T> struct type_identity {
+  using type = T;
 };
 
+template <typename T> using type_identity_t = typename type_identity<T>::type;
+
+template <typename Container, typename = void>
+struct has_size : std::false_type {};
+
+template <typename Container>
+struct has_size<Container,
+                std::void_t<decltype(std::size(std::declval<Container &>()))>>
+    : std::true_type {};
+
 template <typename Value> struct enumerate_pointer_adapter {
   using iterator = Value *;
   using const_iterator = const Value *;
@@ -86,45 +225,234 @@ template <typename Value> struct enumerate_pointer_adapter {
 
   const_iterator cend() const noexcept { return end(); }
 
+  std::size_t size() const noexcept {
+    return static_cast<std::size_t>(end_ - begin_);
+  }
+
 private:
   Value *begin_;
   Value *end_;
 };
 
-template <typename Container> struct enumerate {
+// Iterator pair standing in for a container, so a block of a random-access
+// container can be enumerated on its own.
+template <typename Iterator> struct enumerate_subrange {
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  enumerate_subrange(Iterator begin, Iterator end) noexcept(
+      std::is_nothrow_copy_constructible_v<Iterator>)
+      : begin_(begin), end_(end) {}
+
+  iterator begin() const noexcept { return begin_; }
+
+  iterator end() const noexcept { return end_; }
+
+  std::size_t size() const noexcept {
+    return static_cast<std::size_t>(end_ - begin_);
+  }
+
+private:
+  Iterator begin_;
+  Iterator end_;
+};
+
+// Whether an enumerate over `Container` only refers to elements that live
+// elsewhere. It owns them when it was made from an rvalue container.
+template <typename Container>
+constexpr bool enumerate_borrows_v = std::is_lvalue_reference_v<Container>;
+
+template <typename Value>
+constexpr bool enumerate_borrows_v<enumerate_pointer_adapter<Value>> = true;
+
+template <typename Iterator>
+constexpr bool enumerate_borrows_v<enumerate_subrange<Iterator>> = true;
+
+template <typename Iterator, typename Index> struct enumerate_partition;
+
+template <typename Container, typename Index = std::ptrdiff_t>
+struct enumerate {
   using traits = base_container_traits<Container>;
 
   using container_iterator = typename traits::iterator;
   using const_container_iterator = typename traits::const_iterator;
 
-  using iterator = enumerate_iterator<container_iterator>;
-  using const_iterator = enumerate_iterator<const_container_iterator>;
+  using iterator = enumerate_iterator<container_iterator, Index>;
+  using const_iterator = enumerate_iterator<const_container_iterator, Index>;
 
   using value_type = typename iterator::value_type;
   using difference_type = typename iterator::difference_type;
-
-  explicit enumerate(Container container, std::ptrdiff_t start = {})
-      : container_(std::forward<Container>(container)), start_(start) {}
+  using index_type = Index;
+
+  static_assert(std::is_integral_v<index_type>, "Type is not integral");
+
+  // Every index the elements get, and the one past the last element, has to
+  // fit into the index type. Containers whose size is not known up front are
+  // not checked.
+  explicit enumerate(Container container, index_type start = {})
+      : container_(std::forward<Container>(container)), start_(start) {
+    if constexpr (has_cheap_size_<Container>) {
+      const auto remaining =
+          static_cast<std::uintmax_t>(std::numeric_limits<index_type>::max()) -
+          static_cast<std::uintmax_t>(start_);
+
+      if (static_cast<std::uintmax_t>(size_(container_)) > remaining)
+        throw std::logic_error("too many elements for the index type");
+    }
+  }
 
   iterator begin() noexcept { return iterator(std::begin(container_), start_); }
 
-  iterator end() noexcept { return iterator(std::end(container_), start_); }
+  iterator end() noexcept {
+    return iterator(std::end(container_), end_index_(container_));
+  }
 
   const_iterator begin() const noexcept {
     return const_iterator(std::cbegin(container_), start_);
   }
 
   const_iterator end() const noexcept {
-    return const_iterator(std::cend(container_), start_);
+    return const_iterator(std::cend(container_), end_index_(container_));
   }
 
   const_iterator cbegin() const noexcept { return begin(); }
 
   const_iterator cend() const noexcept { return end(); }
 
+  // Splits the elements into `parts` contiguous blocks whose sizes differ by
+  // at most one. Every block is an enumerate itself and carries on the
+  // numbering of the whole, so the blocks can be processed by different
+  // threads. They refer to the container, which has to outlive them: an
+  // enumerate that owns its container cannot be split as a temporary.
+  auto split(std::size_t parts) & {
+    return partition_(std::begin(container_), whole_().split(parts));
+  }
+
+  auto split(std::size_t parts) const & {
+    return partition_(std::cbegin(container_), whole_().split(parts));
+  }
+
+  template <typename Self = Container,
+            std::enable_if_t<enumerate_borrows_v<Self>, int> = 0>
+  auto split(std::size_t parts) && {
+    return partition_(std::begin(container_), whole_().split(parts));
+  }
+
+  template <typename Self = Container,
+            std::enable_if_t<!enumerate_borrows_v<Self>, int> = 0>
+  auto split(std::size_t parts) && = delete;
+
+  // Splits the elements into contiguous blocks of `grain` elements each,
+  // only the last one may be smaller.
+  auto chunks(std::size_t grain) & {
+    return partition_(std::begin(container_), whole_().chunks(grain));
+  }
+
+  auto chunks(std::size_t grain) const & {
+    return partition_(std::cbegin(container_), whole_().chunks(grain));
+  }
+
+  template <typename Self = Container,
+            std::enable_if_t<enumerate_borrows_v<Self>, int> = 0>
+  auto chunks(std::size_t grain) && {
+    return partition_(std::begin(container_), whole_().chunks(grain));
+  }
+
+  template <typename Self = Container,
+            std::enable_if_t<!enumerate_borrows_v<Self>, int> = 0>
+  auto chunks(std::size_t grain) && = delete;
+
+private:
+  range<std::size_t> whole_() const {
+    static_assert(is_at_least_v<const_container_iterator,
+                                std::random_access_iterator_tag>,
+                  "Container is not random access");
+
+    return range<std::size_t>(size_(container_));
+  }
+
+  template <typename Iterator>
+  enumerate_partition<Iterator, index_type>
+  partition_(Iterator first,
+             const range_partition<std::size_t> &parts) const {
+    return enumerate_partition<Iterator, index_type>(first, start_, parts);
+  }
+
+  template <typename Self>
+  static constexpr bool has_cheap_size_ =
+      is_at_least_v<decltype(std::begin(std::declval<Self &>())),
+                    std::random_access_iterator_tag> ||
+      has_size<Self>::value;
+
+  template <typename Self> static std::size_t size_(Self &container) {
+    if constexpr (is_at_least_v<decltype(std::begin(container)),
+                                std::random_access_iterator_tag>)
+      return static_cast<std::size_t>(std::end(container) -
+                                      std::begin(container));
+    else if constexpr (has_size<Self>::value)
+      return static_cast<std::size_t>(std::size(container));
+    else
+      return static_cast<std::size_t>(
+          std::distance(std::begin(container), std::end(container)));
+  }
+
+  // The end iterator carries the index one past the last element, so that
+  // stepping back from it or indexing relative to it numbers correctly. An
+  // unsized bidirectional container has to be walked once to find it.
+  template <typename Self> index_type end_index_(Self &container) const {
+    using wrapped_iterator = decltype(std::begin(container));
+
+    if constexpr (has_cheap_size_<Self> ||
+                  is_at_least_v<wrapped_iterator,
+                                std::bidirectional_iterator_tag>)
+      return static_cast<index_type>(start_ + size_(container));
+    else
+      return start_;
+  }
+
 private:
-  std::ptrdiff_t start_{};
   Container container_;
+  index_type start_{};
+};
+
+// Allocation-free view of contiguous blocks of an enumerate, one per thread.
+template <typename Iterator, typename Index> struct enumerate_partition {
+  using value_type = enumerate<enumerate_subrange<Iterator>, Index>;
+
+  using iterator = indexed_view_iterator<enumerate_partition>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  enumerate_partition(Iterator first, Index start,
+                      const range_partition<std::size_t> &parts) noexcept
+      : first_(first), start_(start), parts_(parts) {}
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(size()));
+  }
+
+  value_type operator[](std::size_t idx) const {
+    const auto part = parts_[idx];
+    const auto offset = static_cast<difference_type>(*part.begin());
+    const auto block = first_ + offset;
+
+    return value_type(
+        enumerate_subrange<Iterator>(
+            block, block + static_cast<difference_type>(part.size())),
+        static_cast<Index>(start_ + offset));
+  }
+
+  bool empty() const noexcept { return parts_.empty(); }
+
+  std::size_t size() const noexcept { return parts_.size(); }
+
+private:
+  Iterator first_;
+  Index start_;
+  range_partition<std::size_t> parts_;
 };
 
 template <typename ContainerType>
@@ -135,24 +463,51 @@ enumerate(ContainerType &&, std::ptrdiff_t) -> enumerate<ContainerType>;
 
 } // namespace details
 
-template <typename ContainerType>
-auto enumerate(ContainerType &&container, std::ptrdiff_t start = 0) {
-  return details::enumerate(std::forward<ContainerType>(container), start);
+// Numbers the elements of `container` from `start` with indices of type
+// `Index`, e.g. omp::enumerate<std::int32_t>(values) for 32-bit SIMD lanes.
+template <typename Index = std::ptrdiff_t, typename ContainerType>
+auto enumerate(ContainerType &&container,
+               details::type_identity_t<Index> start = 0) {
+  return details::enumerate<ContainerType, Index>(
+      std::forward<ContainerType>(container), start);
 }
 
-template <typename ValueType, size_t size>
-auto enumerate(ValueType (&arr)[size], std::ptrdiff_t start = 0) {
-  return details::enumerate(details::enumerate_pointer_adapter(arr, arr + size),
-                            start);
+template <typename Index = std::ptrdiff_t, typename ValueType, size_t size>
+auto enumerate(ValueType (&arr)[size],
+               details::type_identity_t<Index> start = 0) {
+  return details::enumerate<details::enumerate_pointer_adapter<ValueType>,
+                            Index>(
+      details::enumerate_pointer_adapter(arr, arr + size), start);
 }
 
-template <typename ValueType, size_t size>
-auto enumerate(ValueType (&&arr)[size], std::ptrdiff_t start = 0) = delete;
+template <typename Index = std::ptrdiff_t, typename ValueType, size_t size>
+auto enumerate(ValueType (&&arr)[size],
+               details::type_identity_t<Index> start = 0) = delete;
 
-template <typename ValueType>
-auto enumerate(ValueType *begin, ValueType *end, std::ptrdiff_t start = 0) {
-  return details::enumerate(details::enumerate_pointer_adapter(begin, end),
-                            start);
+template <typename Index = std::ptrdiff_t, typename ValueType>
+auto enumerate(ValueType *begin, ValueType *end,
+               details::type_identity_t<Index> start = 0) {
+  return details::enumerate<details::enumerate_pointer_adapter<ValueType>,
+                            Index>(
+      details::enumerate_pointer_adapter(begin, end), start);
 }
 
 } // namespace omp
+
+namespace std {
+
+template <typename Reference, typename Index>
+struct tuple_size<omp::details::enumerate_reference<Reference, Index>>
+    : std::integral_constant<std::size_t, 2> {};
+
+template <typename Reference, typename Index>
+struct tuple_element<0, omp::details::enumerate_reference<Reference, Index>> {
+  using type = const Index;
+};
+
+template <typename Reference, typename Index>
+struct tuple_element<1, omp::details::enumerate_reference<Reference, Index>> {
+  using type = Reference;
+};
+
+} // namespace std
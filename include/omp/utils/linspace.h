@@ -0,0 +1,149 @@
+#pragma once
+
+#include "range.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace omp {
+namespace details {
+
+template <typename... Ts>
+using floating_common_t =
+    std::conditional_t<std::is_floating_point_v<std::common_type_t<Ts...>>,
+                       std::common_type_t<Ts...>, double>;
+
+// Converts an index below 2^52 to floating point exactly. Going through the
+// bit pattern of a double avoids the 64-bit integer conversion, which has no
+// SIMD instruction before AVX-512 and would keep loops from vectorizing.
+template <typename Floating>
+Floating index_to_floating_(std::size_t idx) noexcept {
+  const auto bits = static_cast<std::uint64_t>(idx) | 0x4330000000000000u;
+
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+
+  return static_cast<Floating>(value - 4503599627370496.0);
+}
+
+constexpr std::uint64_t float_range_max_size_ = std::uint64_t{1} << 52;
+
+// Floating-point values start + i * step for i in [0, size). Every element is
+// computed from its integer index, so no rounding error builds up along the
+// range and element i is the same however the range was reached or split.
+template <typename Floating> struct float_range {
+  using value_type = Floating;
+
+  using iterator = indexed_view_iterator<float_range>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(std::is_floating_point_v<value_type>,
+                "Type is not floating point");
+
+  float_range(value_type start, value_type step, std::size_t size)
+      : start_(start), step_(step), size_(size) {
+    if (static_cast<std::uint64_t>(size_) > float_range_max_size_)
+      throw std::logic_error("too many elements");
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(size_));
+  }
+
+  value_type operator[](std::size_t idx) const noexcept {
+    return start_ + index_to_floating_<value_type>(idx) * step_;
+  }
+
+  value_type step() const noexcept { return step_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  value_type start_;
+  value_type step_;
+  std::size_t size_;
+};
+
+} // namespace details
+
+// `num` evenly spaced values over [start, stop], or [start, stop) when
+// `endpoint` is false. Like every other element, the last one is computed as
+// start + (num - 1) * step, so it may differ from `stop` by a rounding error.
+template <typename Start, typename Stop>
+auto linspace(Start start, Stop stop, std::size_t num, bool endpoint = true) {
+  using value_type = details::floating_common_t<Start, Stop>;
+
+  const auto first = static_cast<value_type>(start);
+  const auto last = static_cast<value_type>(stop);
+
+  value_type step{0};
+
+  if (num > 1 || (num && !endpoint))
+    step = (last - first) / static_cast<value_type>(endpoint ? num - 1 : num);
+
+  return details::float_range<value_type>(first, step, num);
+}
+
+// Values start + i * step that lie in [start, stop), like omp::range but over
+// floating point. The trip count is checked against the computed elements, so
+// the last value never reaches `stop` because of a rounding error in the
+// division.
+template <typename Start, typename Stop, typename Step>
+auto arange(Start start, Stop stop, Step step) {
+  using value_type = details::floating_common_t<Start, Stop, Step>;
+
+  const auto first = static_cast<value_type>(start);
+  const auto last = static_cast<value_type>(stop);
+  const auto delta = static_cast<value_type>(step);
+
+  if (!delta)
+    throw std::logic_error("step is zero");
+
+  const auto span = (last - first) / delta;
+
+  if (std::isnan(span) || std::isinf(span))
+    throw std::logic_error("range is not finite");
+
+  if (span > static_cast<value_type>(details::float_range_max_size_))
+    throw std::logic_error("too many elements");
+
+  const auto before_stop = [&](std::size_t idx) {
+    const auto value =
+        first + details::index_to_floating_<value_type>(idx) * delta;
+
+    return delta > value_type{0} ? value < last : last < value;
+  };
+
+  std::size_t size = span > value_type{0}
+                         ? static_cast<std::size_t>(std::ceil(span))
+                         : 0;
+
+  while (size && !before_stop(size - 1))
+    --size;
+
+  while (before_stop(size))
+    ++size;
+
+  return details::float_range<value_type>(first, delta, size);
+}
+
+template <typename Stop> auto arange(Stop stop) {
+  return arange(Stop{0}, stop, Stop{1});
+}
+
+template <typename Start, typename Stop>
+auto arange(Start start, Stop stop) {
+  return arange(start, stop, 1);
+}
+
+} // namespace omp
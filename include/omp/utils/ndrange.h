@@ -0,0 +1,328 @@
+#pragma once
+
+#include "range.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace omp {
+namespace details {
+
+template <typename Integral, std::size_t Dims> struct ndrange;
+
+// Walks a box in row-major order: the last dimension changes fastest, exactly
+// like the equivalent nested loops. Stepping carries like an odometer, jumps
+// unravel the linear index, and comparisons only look at the linear index.
+// The iterator carries its own copy of the box, so it stays valid after the
+// ndrange it came from is gone.
+template <typename Integral, std::size_t Dims> struct ndrange_iterator {
+  using box = ndrange<Integral, Dims>;
+
+  using iterator_category = std::random_access_iterator_tag;
+
+  using value_type = std::array<Integral, Dims>;
+
+  using reference = value_type;
+  using pointer = const value_type *;
+
+  using difference_type = std::ptrdiff_t;
+
+  ndrange_iterator() noexcept = default;
+
+  ndrange_iterator(const box &owner, difference_type index) noexcept
+      : box_(owner), index_(index), value_(owner.unravel_(index)) {}
+
+  reference operator*() const noexcept { return value_; }
+
+  pointer operator->() const noexcept { return &value_; }
+
+  value_type operator[](difference_type diff) const noexcept {
+    return box_->unravel_(index_ + diff);
+  }
+
+  ndrange_iterator &operator++() noexcept {
+    ++index_;
+
+    for (auto dim = Dims; dim-- > 0;) {
+      if (++value_[dim] != box_->last_[dim])
+        break;
+
+      value_[dim] = box_->first_[dim];
+    }
+
+    return *this;
+  }
+
+  ndrange_iterator operator++(int) noexcept {
+    auto temp = *this;
+    ++(*this);
+
+    return temp;
+  }
+
+  ndrange_iterator &operator--() noexcept { return *this -= 1; }
+
+  ndrange_iterator operator--(int) noexcept {
+    auto temp = *this;
+    --(*this);
+
+    return temp;
+  }
+
+  ndrange_iterator &operator+=(difference_type diff) noexcept {
+    index_ += diff;
+    value_ = box_->unravel_(index_);
+
+    return *this;
+  }
+
+  ndrange_iterator operator+(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp += diff;
+  }
+
+  friend ndrange_iterator operator+(difference_type diff,
+                                    const ndrange_iterator &iter) noexcept {
+    return iter + diff;
+  }
+
+  ndrange_iterator &operator-=(difference_type diff) noexcept {
+    return *this += -diff;
+  }
+
+  ndrange_iterator operator-(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp -= diff;
+  }
+
+  difference_type operator-(const ndrange_iterator &rhs) const noexcept {
+    return index_ - rhs.index_;
+  }
+
+  bool operator==(const ndrange_iterator &rhs) const noexcept {
+    return index_ == rhs.index_;
+  }
+
+  bool operator!=(const ndrange_iterator &rhs) const noexcept {
+    return !(*this == rhs);
+  }
+
+  bool operator<(const ndrange_iterator &rhs) const noexcept {
+    return index_ < rhs.index_;
+  }
+
+  bool operator>(const ndrange_iterator &rhs) const noexcept {
+    return rhs < *this;
+  }
+
+  bool operator<=(const ndrange_iterator &rhs) const noexcept {
+    return !(*this > rhs);
+  }
+
+  bool operator>=(const ndrange_iterator &rhs) const noexcept {
+    return !(*this < rhs);
+  }
+
+private:
+  // Optional only so that the iterator stays default constructible.
+  std::optional<box> box_;
+  difference_type index_{};
+  value_type value_{};
+};
+
+template <typename Integral, std::size_t Dims> struct ndrange_tiles;
+
+struct ndrange_extents_tag {};
+
+// The box [first, last) of a Dims-dimensional index space.
+template <typename Integral, std::size_t Dims> struct ndrange {
+  using value_type = std::array<Integral, Dims>;
+  using extents_type = std::array<std::size_t, Dims>;
+
+  using iterator = ndrange_iterator<Integral, Dims>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(std::is_integral_v<Integral>, "Type is not integral");
+  static_assert(Dims > 0, "Dimension count is zero");
+
+  ndrange(const value_type &first, const value_type &last) noexcept
+      : first_(first) {
+    for (std::size_t dim = 0; dim < Dims; ++dim)
+      extents_[dim] = range_size_(first[dim], last[dim], Integral{1});
+
+    init_();
+  }
+
+  ndrange(const value_type &first, const extents_type &extents,
+          ndrange_extents_tag) noexcept
+      : first_(first), extents_(extents) {
+    init_();
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(size_));
+  }
+
+  // Index tuple of the element at position `idx` in row-major order.
+  value_type operator[](std::size_t idx) const noexcept {
+    return unravel_(static_cast<difference_type>(idx));
+  }
+
+  const value_type &first() const noexcept { return first_; }
+
+  const extents_type &extents() const noexcept { return extents_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  // The collapsed index space: split it with range::split/range::chunks and
+  // map positions back to index tuples with operator[].
+  range<std::size_t> linear() const noexcept {
+    return range<std::size_t>(size_);
+  }
+
+  // Splits the box into tiles of `tile` elements per dimension, only the tiles
+  // on the upper edges may be smaller. Tiles are visited in row-major order.
+  ndrange_tiles<Integral, Dims> tiled(const extents_type &tile) const {
+    for (auto extent : tile)
+      if (!extent)
+        throw std::logic_error("tile is zero");
+
+    return ndrange_tiles<Integral, Dims>(*this, tile);
+  }
+
+private:
+  friend iterator;
+
+  void init_() noexcept {
+    size_ = 1;
+
+    for (std::size_t dim = 0; dim < Dims; ++dim) {
+      last_[dim] = static_cast<Integral>(first_[dim] + extents_[dim]);
+      size_ *= extents_[dim];
+    }
+  }
+
+  value_type unravel_(difference_type index) const noexcept {
+    auto value = first_;
+
+    if (!size_)
+      return value;
+
+    auto rest = static_cast<std::size_t>(index);
+
+    for (auto dim = Dims; dim-- > 0;) {
+      value[dim] = static_cast<Integral>(first_[dim] + rest % extents_[dim]);
+      rest /= extents_[dim];
+    }
+
+    return value;
+  }
+
+private:
+  value_type first_;
+  value_type last_{};
+  extents_type extents_{};
+  std::size_t size_{};
+};
+
+// Allocation-free view of the tiles of an ndrange, each tile an ndrange
+// itself. Tiles are independent blocks, so they can be handed out to threads.
+template <typename Integral, std::size_t Dims> struct ndrange_tiles {
+  using value_type = ndrange<Integral, Dims>;
+  using extents_type = typename value_type::extents_type;
+
+  using iterator = indexed_view_iterator<ndrange_tiles>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  ndrange_tiles(const value_type &box, const extents_type &tile) noexcept
+      : box_(box), tile_(tile) {
+    count_ = box_.empty() ? 0 : 1;
+
+    for (std::size_t dim = 0; dim < Dims; ++dim) {
+      counts_[dim] = (box_.extents()[dim] + tile_[dim] - 1) / tile_[dim];
+      count_ *= counts_[dim];
+    }
+  }
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(count_));
+  }
+
+  value_type operator[](std::size_t idx) const noexcept {
+    auto first = box_.first();
+    auto extents = tile_;
+
+    for (auto dim = Dims; dim-- > 0;) {
+      const auto offset = idx % counts_[dim] * tile_[dim];
+
+      first[dim] = static_cast<Integral>(first[dim] + offset);
+      extents[dim] = std::min(tile_[dim], box_.extents()[dim] - offset);
+
+      idx /= counts_[dim];
+    }
+
+    return value_type(first, extents, ndrange_extents_tag{});
+  }
+
+  const extents_type &counts() const noexcept { return counts_; }
+
+  bool empty() const noexcept { return count_ == 0; }
+
+  std::size_t size() const noexcept { return count_; }
+
+private:
+  value_type box_;
+  extents_type tile_;
+  extents_type counts_{};
+  std::size_t count_{};
+};
+
+} // namespace details
+
+template <typename Integral, std::size_t Dims>
+auto ndrange(const std::array<Integral, Dims> &extents) {
+  return details::ndrange<Integral, Dims>(std::array<Integral, Dims>{},
+                                          extents);
+}
+
+template <typename Integral, std::size_t Dims>
+auto ndrange(const Integral (&extents)[Dims]) {
+  std::array<Integral, Dims> last{};
+  std::copy(std::begin(extents), std::end(extents), std::begin(last));
+
+  return ndrange(last);
+}
+
+template <typename Integral, std::size_t Dims>
+auto ndrange(const std::array<Integral, Dims> &first,
+             const std::array<Integral, Dims> &last) {
+  return details::ndrange<Integral, Dims>(first, last);
+}
+
+template <typename Integral, std::size_t Dims>
+auto ndrange(const Integral (&first)[Dims], const Integral (&last)[Dims]) {
+  std::array<Integral, Dims> lower{}, upper{};
+  std::copy(std::begin(first), std::end(first), std::begin(lower));
+  std::copy(std::begin(last), std::end(last), std::begin(upper));
+
+  return ndrange(lower, upper);
+}
+
+} // namespace omp
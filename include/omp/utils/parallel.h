@@ -0,0 +1,358 @@
+#pragma once
+
+#include "thread_pool.h"
+#include "tuple_map_reduce.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace omp {
+namespace details {
+
+constexpr std::size_t cache_line_ = 64;
+
+template <typename View>
+using view_iterator_t = decltype(std::begin(std::declval<View &>()));
+
+template <typename Iterator>
+constexpr bool is_random_access_v = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<Iterator>::iterator_category>;
+
+// Splits [first, last) by lazy binary splitting: the running task only
+// halves its range and hands the upper half to the pool when its own deque
+// is empty, i.e. when the halves it spawned before have been stolen by idle
+// workers. Otherwise it just works through the next `grain` elements. The
+// number of tasks therefore follows the actual demand of the pool, not the
+// size of the range.
+//
+// `leaf` reduces a non-empty subrange to a partial result and `combine` joins
+// two partial results of adjacent subranges, left one first. The order of the
+// elements is preserved, so `combine` has to be associative but not
+// commutative.
+//
+// The partial results of stolen halves are written by other workers while
+// this one keeps spawning, so each of them sits on its own cache line.
+template <typename Result, typename Iterator, typename Leaf, typename Combine>
+Result lazy_split_(thread_pool &pool, Iterator first, Iterator last,
+                   std::size_t grain, const Leaf &leaf,
+                   const Combine &combine) {
+  struct alignas(cache_line_) child {
+    std::optional<Result> value;
+    std::exception_ptr error;
+    std::atomic<bool> done{false};
+  };
+
+  using difference_type =
+      typename std::iterator_traits<Iterator>::difference_type;
+
+  const auto chunk = static_cast<difference_type>(grain);
+
+  // Each split halves the range, so the depth is bounded by the bit width.
+  child children[sizeof(difference_type) * 8];
+  std::size_t spawned = 0;
+
+  std::optional<Result> result;
+  std::exception_ptr error;
+
+  const auto fold = [&](Iterator from, Iterator to) {
+    auto partial = leaf(from, to);
+
+    if (result)
+      result.emplace(combine(std::move(*result), std::move(partial)));
+    else
+      result.emplace(std::move(partial));
+  };
+
+  try {
+    while (last - first > chunk) {
+      if (pool.local_empty()) {
+        const auto middle = first + (last - first) / 2;
+        auto &spawn = children[spawned++];
+
+        pool.submit([&pool, &spawn, &leaf, &combine, middle, last, grain] {
+          try {
+            spawn.value.emplace(lazy_split_<Result>(pool, middle, last, grain,
+                                                    leaf, combine));
+          } catch (...) {
+            spawn.error = std::current_exception();
+          }
+
+          spawn.done.store(true, std::memory_order_release);
+        });
+
+        last = middle;
+      } else {
+        fold(first, first + chunk);
+        first += chunk;
+      }
+    }
+
+    fold(first, last);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // The children refer to this frame, so they are joined even after a throw.
+  // Later spawns cover subranges further to the left, so joining them from
+  // the last one keeps the results in element order.
+  while (spawned) {
+    auto &spawn = children[--spawned];
+
+    pool.wait(spawn.done);
+
+    if (error)
+      continue;
+
+    if (spawn.error)
+      error = spawn.error;
+    else
+      result.emplace(combine(std::move(*result), std::move(*spawn.value)));
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+
+  return std::move(*result);
+}
+
+inline std::size_t default_grain_(std::size_t size, const thread_pool &pool) {
+  return std::max<std::size_t>(1, size / (pool.size() * 64));
+}
+
+struct no_result_ {};
+
+struct identity_ {
+  template <typename T> T &&operator()(T &&value) const noexcept {
+    return std::forward<T>(value);
+  }
+};
+
+// Slot of one element of parallel_tuple_map, on its own cache line since
+// every slot is written by a different worker. The result is wrapped in a
+// tuple so that references can be stored as well.
+template <typename Result> struct alignas(cache_line_) tuple_task_ {
+  std::optional<std::tuple<Result>> value;
+  std::exception_ptr error;
+  std::atomic<bool> done{false};
+};
+
+template <std::size_t... Idxs, typename Callable, typename... Tuples>
+auto parallel_tuple_map_(thread_pool &pool, std::index_sequence<Idxs...>,
+                         Callable &call, Tuples &&...tups) {
+  using result = std::tuple<decltype(map_one<Idxs>(
+      call, std::forward<Tuples>(tups)...))...>;
+
+  std::tuple<tuple_task_<std::tuple_element_t<Idxs, result>>...> tasks;
+
+  const auto execute = [&](auto idx) {
+    constexpr auto Idx = decltype(idx)::value;
+
+    auto &task = std::get<Idx>(tasks);
+
+    try {
+      task.value.emplace(map_one<Idx>(call, std::forward<Tuples>(tups)...));
+    } catch (...) {
+      task.error = std::current_exception();
+    }
+
+    task.done.store(true, std::memory_order_release);
+  };
+
+  // The first element runs on the calling worker, which then helps with the
+  // others while it waits for them.
+  (..., [&] {
+    if constexpr (Idxs != 0)
+      pool.submit([&execute] {
+        execute(std::integral_constant<std::size_t, Idxs>());
+      });
+  }());
+
+  execute(std::integral_constant<std::size_t, 0>());
+
+  (..., pool.wait(std::get<Idxs>(tasks).done));
+
+  (..., [&] {
+    if (const auto &error = std::get<Idxs>(tasks).error)
+      std::rethrow_exception(error);
+  }());
+
+  return result(std::get<0>(std::move(*std::get<Idxs>(tasks).value))...);
+}
+
+} // namespace details
+
+// Calls `call` with every element of `view` on the workers of `pool`. The
+// view has to be random access: omp::range, ndrange, linspace, a partition,
+// a std::vector... `grain` is the number of elements processed between two
+// checks for idle workers, 0 picks one from the size of the view.
+template <typename View, typename Callable>
+void parallel_for(thread_pool &pool, View &&view, Callable &&call,
+                  std::size_t grain = 0) {
+  using std::begin;
+  using std::end;
+
+  using iterator = details::view_iterator_t<View>;
+
+  static_assert(details::is_random_access_v<iterator>,
+                "View is not random access");
+
+  auto first = begin(view);
+  auto last = end(view);
+
+  if (first == last)
+    return;
+
+  const auto size = static_cast<std::size_t>(last - first);
+
+  if (!grain)
+    grain = details::default_grain_(size, pool);
+
+  const auto leaf = [&call](iterator from, iterator to) {
+    for (; from != to; ++from)
+      call(*from);
+
+    return details::no_result_{};
+  };
+
+  const auto combine = [](details::no_result_, details::no_result_) {
+    return details::no_result_{};
+  };
+
+  pool.run([&] {
+    details::lazy_split_<details::no_result_>(pool, first, last, grain, leaf,
+                                              combine);
+  });
+}
+
+template <typename View, typename Callable>
+void parallel_for(View &&view, Callable &&call, std::size_t grain = 0) {
+  parallel_for(thread_pool::global(), std::forward<View>(view),
+               std::forward<Callable>(call), grain);
+}
+
+// Applies `transform` to every element of `view` and reduces the results
+// with `reduce` on the workers of `pool`, like std::transform_reduce. Any
+// random access view works, omp::zip and omp::enumerate included, so inner
+// products and multi-column aggregates need no unpacking into raw pointers:
+//
+//   omp::parallel_transform_reduce(omp::zip(x, y), 0.0, std::plus<>(),
+//                                  [](auto xy) {
+//                                    auto [a, b] = xy;
+//                                    return a * b;
+//                                  });
+template <typename View, typename Value, typename Reduce, typename Transform>
+Value parallel_transform_reduce(thread_pool &pool, View &&view, Value init,
+                                Reduce &&reduce, Transform &&transform,
+                                std::size_t grain = 0) {
+  using std::begin;
+  using std::end;
+
+  using iterator = details::view_iterator_t<View>;
+
+  static_assert(details::is_random_access_v<iterator>,
+                "View is not random access");
+
+  auto first = begin(view);
+  auto last = end(view);
+
+  if (first == last)
+    return init;
+
+  const auto size = static_cast<std::size_t>(last - first);
+
+  if (!grain)
+    grain = details::default_grain_(size, pool);
+
+  const auto leaf = [&reduce, &transform](iterator from, iterator to) {
+    Value partial = transform(*from);
+
+    while (++from != to)
+      partial = reduce(std::move(partial), transform(*from));
+
+    return partial;
+  };
+
+  const auto combine = [&reduce](Value lhs, Value rhs) {
+    return reduce(std::move(lhs), std::move(rhs));
+  };
+
+  std::optional<Value> result;
+
+  pool.run([&] {
+    result.emplace(
+        details::lazy_split_<Value>(pool, first, last, grain, leaf, combine));
+  });
+
+  return reduce(std::move(init), std::move(*result));
+}
+
+template <typename View, typename Value, typename Reduce, typename Transform>
+Value parallel_transform_reduce(View &&view, Value init, Reduce &&reduce,
+                                Transform &&transform, std::size_t grain = 0) {
+  return parallel_transform_reduce(
+      thread_pool::global(), std::forward<View>(view), std::move(init),
+      std::forward<Reduce>(reduce), std::forward<Transform>(transform), grain);
+}
+
+// Reduces the elements of `view` with `op` on the workers of `pool`, like
+// std::reduce: `op` has to be associative, the elements keep their order.
+template <typename View, typename Value, typename Operation>
+Value parallel_reduce(thread_pool &pool, View &&view, Value init,
+                      Operation &&op, std::size_t grain = 0) {
+  return parallel_transform_reduce(pool, std::forward<View>(view),
+                                   std::move(init), std::forward<Operation>(op),
+                                   details::identity_(), grain);
+}
+template <typename View, typename Value, typename Operation>
+Value parallel_reduce(View &&view, Value init, Operation &&op,
+                      std::size_t grain = 0) {
+  return parallel_reduce(thread_pool::global(), std::forward<View>(view),
+                         std::move(init), std::forward<Operation>(op), grain);
+}
+
+// Same result as omp::tuple_map, but every element is mapped by its own task
+// on the workers of `pool`, so a tuple of independent, heterogeneous jobs runs
+// concurrently. Returns once all of them are done and rethrows the exception
+// of the first element that failed.
+template <
+    typename Callable, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+auto parallel_tuple_map(thread_pool &pool, Callable &&call, Tuples &&...tups) {
+  using indices = details::tuple_indices_<Tuples...>;
+  using result = decltype(omp::tuple_map(call, std::forward<Tuples>(tups)...));
+
+  if constexpr (indices::size() == 0) {
+    return result();
+  } else {
+    std::optional<result> mapped;
+
+    pool.run([&] {
+      mapped.emplace(details::parallel_tuple_map_(
+          pool, indices(), call, std::forward<Tuples>(tups)...));
+    });
+
+    return std::move(*mapped);
+  }
+}
+
+template <
+    typename Callable, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+auto parallel_tuple_map(Callable &&call, Tuples &&...tups) {
+  return parallel_tuple_map(thread_pool::global(), std::forward<Callable>(call),
+                            std::forward<Tuples>(tups)...);
+}
+
+} // namespace omp
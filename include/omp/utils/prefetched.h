@@ -0,0 +1,236 @@
+#pragma once
+
+#include "base_container_traits.h"
+#include "enumerate.h"
+#include "zip.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace omp {
+namespace details {
+
+// Hint only: a no-op on compilers without the builtin, and it never faults,
+// even for addresses past the end of a buffer.
+inline void prefetch_(const void *address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+// Default target of omp::prefetched: every member of the element that lives
+// in memory, i.e. every member reached through an lvalue reference.
+// Elements computed on the fly, like the indices of omp::range, are skipped.
+struct prefetch_members_ {
+  template <typename Reference>
+  void operator()(Reference &&element) const noexcept {
+    member_<Reference>(element);
+  }
+
+private:
+  template <typename Reference, typename Element>
+  static void member_(const Element &element) noexcept {
+    if constexpr (std::is_lvalue_reference_v<Reference>)
+      prefetch_(std::addressof(element));
+  }
+
+  template <typename Reference, typename... References>
+  static void member_(const zip_reference<References...> &refs) noexcept {
+    std::apply(
+        [](const auto &...members) { (..., member_<References>(members)); },
+        refs.refs());
+  }
+
+  template <typename Reference, typename Wrapped, typename Index>
+  static void
+  member_(const enumerate_reference<Wrapped, Index> &element) noexcept {
+    member_<Wrapped>(element.second);
+  }
+};
+
+// Carries its own copy of the target, so it stays valid after the
+// prefetched_view it came from is gone.
+template <typename Iterator, typename Target> class prefetched_iterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+  using reference = typename std::iterator_traits<Iterator>::reference;
+  using pointer = typename std::iterator_traits<Iterator>::pointer;
+
+  using difference_type = std::ptrdiff_t;
+
+  prefetched_iterator() = default;
+
+  prefetched_iterator(Iterator current, Iterator last, std::size_t distance,
+                      const Target &target)
+      : current_(current), ahead_(current), last_(last), target_(target) {
+    if constexpr (std::is_base_of_v<std::random_access_iterator_tag,
+                                    typename std::iterator_traits<
+                                        Iterator>::iterator_category>)
+      ahead_ += std::min(static_cast<difference_type>(distance),
+                         static_cast<difference_type>(last_ - ahead_));
+    else
+      for (; distance && ahead_ != last_; --distance)
+        ++ahead_;
+  }
+
+  prefetched_iterator(const prefetched_iterator &) = default;
+
+  // Lambdas cannot be assigned, so the target is copied in again instead.
+  prefetched_iterator &operator=(const prefetched_iterator &rhs) {
+    current_ = rhs.current_;
+    ahead_ = rhs.ahead_;
+    last_ = rhs.last_;
+
+    if (rhs.target_)
+      target_.emplace(*rhs.target_);
+    else
+      target_.reset();
+
+    return *this;
+  }
+
+  reference operator*() const { return *current_; }
+
+  prefetched_iterator &operator++() {
+    ++current_;
+
+    if (ahead_ != last_) {
+      prefetch_ahead_(*ahead_);
+      ++ahead_;
+    }
+
+    return *this;
+  }
+
+  prefetched_iterator operator++(int) {
+    auto temp = *this;
+    ++(*this);
+
+    return temp;
+  }
+
+  bool operator==(const prefetched_iterator &rhs) const {
+    return current_ == rhs.current_;
+  }
+
+  bool operator!=(const prefetched_iterator &rhs) const {
+    return !(*this == rhs);
+  }
+
+  const Iterator &base() const noexcept { return current_; }
+
+private:
+  // A target either prefetches by itself or returns the address to prefetch.
+  template <typename Reference> void prefetch_ahead_(Reference &&ahead) const {
+    using result = decltype((*target_)(std::forward<Reference>(ahead)));
+
+    if constexpr (std::is_void_v<result>)
+      (*target_)(std::forward<Reference>(ahead));
+    else
+      prefetch_((*target_)(std::forward<Reference>(ahead)));
+  }
+
+private:
+  Iterator current_{};
+  Iterator ahead_{};
+  Iterator last_{};
+  // Optional only so that the iterator stays default constructible.
+  std::optional<Target> target_;
+};
+
+template <typename View, typename Target> struct prefetched_view {
+  using iterator =
+      prefetched_iterator<typename base_container_traits<View>::iterator,
+                          Target>;
+  using const_iterator =
+      prefetched_iterator<typename base_container_traits<View>::const_iterator,
+                          Target>;
+
+  using value_type = typename iterator::value_type;
+
+  template <typename IncomingView = View>
+  prefetched_view(IncomingView &&view, std::size_t distance, Target target)
+      : view_(std::forward<IncomingView>(view)), distance_(distance),
+        target_(std::move(target)) {}
+
+  iterator begin() {
+    using std::begin;
+    using std::end;
+
+    return iterator(begin(view_), end(view_), distance_, target_);
+  }
+
+  iterator end() {
+    using std::end;
+
+    return iterator(end(view_), end(view_), 0, target_);
+  }
+
+  const_iterator begin() const {
+    using std::begin;
+    using std::end;
+
+    return const_iterator(begin(view_), end(view_), distance_, target_);
+  }
+
+  const_iterator end() const {
+    using std::end;
+
+    return const_iterator(end(view_), end(view_), 0, target_);
+  }
+
+  const_iterator cbegin() const { return begin(); }
+
+  const_iterator cend() const { return end(); }
+
+  std::size_t distance() const noexcept { return distance_; }
+
+private:
+  View view_;
+  std::size_t distance_;
+  Target target_;
+};
+
+} // namespace details
+
+// Walks `view` while prefetching the element `distance` steps ahead of the
+// current one, so that the cache misses of large or pointer-chasing walks
+// overlap with the work on the current element. Every member of a zip and
+// the element of an enumerate are prefetched.
+//
+// The distance is best found by measuring: it has to cover the memory
+// latency, roughly latency / time per element, without running so far ahead
+// that prefetched lines are evicted before they are used.
+template <typename View>
+auto prefetched(View &&view, std::size_t distance) {
+  return details::prefetched_view<View, details::prefetch_members_>(
+      std::forward<View>(view), distance, details::prefetch_members_());
+}
+
+// Same, but `target` maps the element ahead to the address to prefetch. That
+// covers index-driven gathers, whose hot loads are not the elements of the
+// view itself:
+//
+//   for (auto [idx, out] : omp::prefetched(omp::zip(indices, output), 16,
+//                                          [&](auto ahead) {
+//                                            return &data[std::get<0>(ahead)];
+//                                          }))
+//     out = data[idx];
+template <typename View, typename Target>
+auto prefetched(View &&view, std::size_t distance, Target target) {
+  return details::prefetched_view<View, Target>(std::forward<View>(view),
+                                                distance, std::move(target));
+}
+
+} // namespace omp
@@ -1,32 +1,99 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <iterator>
+#include <limits>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
 
 namespace omp {
 namespace details {
 
+// Unsigned type wide enough to do wrap-around arithmetic on Integral without
+// integral promotion turning it back into signed int.
+template <typename Integral>
+using range_unsigned_t =
+    std::common_type_t<std::make_unsigned_t<Integral>, unsigned int>;
+
+// Counts the values in [start, stop) reachable with step. Differences are
+// taken in the unsigned counterpart of the type, so the result is exact for
+// any sign of the step and for ranges wider than the signed type.
+template <typename Integral>
+std::size_t range_size_(Integral start, Integral stop,
+                        Integral step) noexcept {
+  using unsigned_type = range_unsigned_t<Integral>;
+
+  if (step > Integral{0}) {
+    if (!(start < stop))
+      return 0;
+
+    const auto distance = static_cast<unsigned_type>(stop) -
+                          static_cast<unsigned_type>(start);
+
+    return static_cast<std::size_t>(
+        (distance - 1) / static_cast<unsigned_type>(step) + 1);
+  }
+
+  if (!(stop < start))
+    return 0;
+
+  const auto distance =
+      static_cast<unsigned_type>(start) - static_cast<unsigned_type>(stop);
+  const auto magnitude = unsigned_type{0} - static_cast<unsigned_type>(step);
+
+  return static_cast<std::size_t>((distance - 1) / magnitude + 1);
+}
+
+// Returns value + count * step with wrap-around arithmetic, so jumping to the
+// element right past the last one never overflows the signed type.
+template <typename Integral>
+Integral range_advance_(Integral value, Integral step,
+                        std::ptrdiff_t count) noexcept {
+  using unsigned_type = range_unsigned_t<Integral>;
+
+  return static_cast<Integral>(static_cast<unsigned_type>(value) +
+                               static_cast<unsigned_type>(count) *
+                                   static_cast<unsigned_type>(step));
+}
+
 template <typename Integral> struct range_iterator {
-  using iterator_category = std::forward_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
 
   using value_type = Integral;
 
-  using reference = const value_type &;
+  // Values are yielded by copy: a reference into the iterator itself would
+  // dangle inside std::reverse_iterator and other stashing adaptors.
+  using reference = value_type;
   using pointer = const value_type *;
 
-  using difference_type = value_type;
+  using difference_type = std::ptrdiff_t;
 
-  range_iterator(value_type value, value_type step)
-      : value_(value), step_(step) {}
+  range_iterator() noexcept = default;
+
+  range_iterator(value_type value, value_type step,
+                 difference_type index = {}) noexcept
+      : value_(value), step_(step), index_(index) {}
 
   reference operator*() const noexcept { return value_; }
 
   pointer operator->() const noexcept { return &value_; }
 
+  value_type operator[](difference_type diff) const noexcept {
+    return range_advance_(value_, step_, diff);
+  }
+
+  // Stepping uses the same wrap-around arithmetic as jumps, so stepping past
+  // the last element never overflows, e.g. in range(0, INT_MAX, 7). Loops
+  // still end on the index alone, so they stay counted.
   range_iterator &operator++() noexcept {
-    value_ += step_;
+    value_ = range_advance_(value_, step_, 1);
+    ++index_;
+
     return *this;
   }
 
@@ -37,23 +104,87 @@ template <typename Integral> struct range_iterator {
     return temp;
   }
 
+  range_iterator &operator--() noexcept {
+    value_ = range_advance_(value_, step_, -1);
+    --index_;
+
+    return *this;
+  }
+
+  range_iterator operator--(int) noexcept {
+    auto temp = *this;
+    --(*this);
+
+    return temp;
+  }
+
+  range_iterator &operator+=(difference_type diff) noexcept {
+    value_ = range_advance_(value_, step_, diff);
+    index_ += diff;
+
+    return *this;
+  }
+
+  range_iterator operator+(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp += diff;
+  }
+
+  friend range_iterator operator+(difference_type diff,
+                                  const range_iterator &iter) noexcept {
+    return iter + diff;
+  }
+
+  range_iterator &operator-=(difference_type diff) noexcept {
+    return *this += -diff;
+  }
+
+  range_iterator operator-(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp -= diff;
+  }
+
+  difference_type operator-(const range_iterator &rhs) const noexcept {
+    return index_ - rhs.index_;
+  }
+
   bool operator==(const range_iterator &rhs) const noexcept {
-    return step_ != rhs.step_ || compare(value_, rhs.value_, step_);
+    return index_ == rhs.index_;
   }
 
   bool operator!=(const range_iterator &rhs) const noexcept {
     return !(*this == rhs);
   }
 
-private:
-  bool compare(value_type lhs, value_type rhs, value_type sign) const noexcept {
-    return sign > 0 ? lhs >= rhs : lhs <= rhs;
+  bool operator<(const range_iterator &rhs) const noexcept {
+    return index_ < rhs.index_;
+  }
+
+  bool operator>(const range_iterator &rhs) const noexcept {
+    return rhs < *this;
+  }
+
+  bool operator<=(const range_iterator &rhs) const noexcept {
+    return !(*this > rhs);
+  }
+
+  bool operator>=(const range_iterator &rhs) const noexcept {
+    return !(*this < rhs);
   }
 
 private:
-  const value_type step_;
-  value_type value_;
+  value_type value_{};
+  value_type step_{1};
+  difference_type index_{};
 };
+
+template <typename Integral> struct range_partition;
+
+template <typename Integral, std::size_t Width> struct range_batches;
+
+struct range_slice_tag {};
 } // namespace details
 
 template <typename Integral> struct range {
@@ -62,6 +193,8 @@ template <typename Integral> struct range {
   using iterator = details::range_iterator<value_type>;
   using const_iterator = details::range_iterator<value_type>;
 
+  using difference_type = typename iterator::difference_type;
+
   static_assert(std::is_integral_v<value_type>, "Type is not integral");
 
   range(value_type stop) : range(value_type{0}, stop, value_type{1}) {}
@@ -69,30 +202,305 @@ template <typename Integral> struct range {
   range(value_type start, value_type stop)
       : range(start, stop, value_type{1}) {}
 
+  // Throws when the step is zero and when the range has more elements than
+  // iterators can count, e.g. range<std::uint64_t>(0, UINT64_MAX).
   range(value_type start, value_type stop, value_type step)
-      : start_(start), stop_(stop), step_(step) {
+      : start_(start), step_(step) {
     if (!step_)
       throw std::logic_error("step is zero");
+
+    size_ = details::range_size_(start_, stop, step_);
+
+    if (size_ > static_cast<std::size_t>(
+                    std::numeric_limits<difference_type>::max()))
+      throw std::logic_error("too many elements");
   }
 
   const_iterator begin() const noexcept {
     return const_iterator(start_, step_);
   }
 
-  const_iterator end() const noexcept { return const_iterator(stop_, step_); }
+  const_iterator end() const noexcept {
+    return begin() + static_cast<difference_type>(size_);
+  }
+
+  value_type operator[](std::size_t idx) const noexcept {
+    return begin()[static_cast<difference_type>(idx)];
+  }
+
+  value_type step() const noexcept { return step_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  std::size_t size() const noexcept { return size_; }
+
+  // Elements [first, last) of this range as a range with the same step.
+  range slice(std::size_t first, std::size_t last) const noexcept {
+    return range((*this)[first], step_, last - first,
+                 details::range_slice_tag{});
+  }
+
+  // Splits the range into exactly `parts` sub-ranges whose sizes differ by at
+  // most one element.
+  details::range_partition<value_type> split(std::size_t parts) const {
+    if (!parts)
+      throw std::logic_error("parts is zero");
+
+    return details::range_partition<value_type>(*this, size_ / parts,
+                                                size_ % parts, parts);
+  }
+
+  // Splits the range into sub-ranges of `grain` elements each, only the last
+  // one may be shorter.
+  details::range_partition<value_type> chunks(std::size_t grain) const {
+    if (!grain)
+      throw std::logic_error("grain is zero");
+
+    return details::range_partition<value_type>(*this, grain, 0,
+                                                (size_ + grain - 1) / grain);
+  }
+
+  // The full batches of `Width` consecutive values, each as one lane pack.
+  // The values that do not fill a whole batch are left in tail().
+  template <std::size_t Width>
+  details::range_batches<value_type, Width> batches() const noexcept {
+    return details::range_batches<value_type, Width>(*this);
+  }
+
+private:
+  range(value_type start, value_type step, std::size_t size,
+        details::range_slice_tag) noexcept
+      : start_(start), step_(step), size_(size) {}
+
+private:
+  value_type start_;
+  value_type step_;
+  std::size_t size_{};
+};
+
+namespace details {
+
+// Random-access iterator over any view that hands out its elements by value
+// through operator[](std::size_t). The views built on it are small value types
+// and the iterator carries its own copy of the view, so like range_iterator it
+// stays valid after the view it came from is gone.
+template <typename View> struct indexed_view_iterator {
+  using iterator_category = std::random_access_iterator_tag;
+
+  using value_type = typename View::value_type;
+
+  using reference = value_type;
+  using pointer = void;
+
+  using difference_type = std::ptrdiff_t;
+
+  indexed_view_iterator() noexcept = default;
+
+  indexed_view_iterator(const View &view, difference_type index) noexcept
+      : view_(view), index_(index) {}
+
+  reference operator*() const noexcept {
+    return (*view_)[static_cast<std::size_t>(index_)];
+  }
+
+  reference operator[](difference_type diff) const noexcept {
+    return *(*this + diff);
+  }
+
+  indexed_view_iterator &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+
+  indexed_view_iterator operator++(int) noexcept {
+    auto temp = *this;
+    ++(*this);
+
+    return temp;
+  }
+
+  indexed_view_iterator &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+
+  indexed_view_iterator operator--(int) noexcept {
+    auto temp = *this;
+    --(*this);
+
+    return temp;
+  }
+
+  indexed_view_iterator &operator+=(difference_type diff) noexcept {
+    index_ += diff;
+    return *this;
+  }
+
+  indexed_view_iterator operator+(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp += diff;
+  }
+
+  friend indexed_view_iterator
+  operator+(difference_type diff, const indexed_view_iterator &iter) noexcept {
+    return iter + diff;
+  }
+
+  indexed_view_iterator &operator-=(difference_type diff) noexcept {
+    return *this += -diff;
+  }
+
+  indexed_view_iterator operator-(difference_type diff) const noexcept {
+    auto temp = *this;
+
+    return temp -= diff;
+  }
+
+  difference_type operator-(const indexed_view_iterator &rhs) const noexcept {
+    return index_ - rhs.index_;
+  }
+
+  bool operator==(const indexed_view_iterator &rhs) const noexcept {
+    return index_ == rhs.index_;
+  }
+
+  bool operator!=(const indexed_view_iterator &rhs) const noexcept {
+    return !(*this == rhs);
+  }
+
+  bool operator<(const indexed_view_iterator &rhs) const noexcept {
+    return index_ < rhs.index_;
+  }
+
+  bool operator>(const indexed_view_iterator &rhs) const noexcept {
+    return rhs < *this;
+  }
+
+  bool operator<=(const indexed_view_iterator &rhs) const noexcept {
+    return !(*this > rhs);
+  }
+
+  bool operator>=(const indexed_view_iterator &rhs) const noexcept {
+    return !(*this < rhs);
+  }
+
+private:
+  // Optional only so that the iterator stays default constructible.
+  std::optional<View> view_;
+  difference_type index_{};
+};
+
+// Allocation-free view of the sub-ranges of a range. Sub-range i starts at
+// element i * chunk + min(i, remainder), so the first `remainder` parts get
+// one extra element.
+template <typename Integral> struct range_partition {
+  using value_type = range<Integral>;
+
+  using iterator = indexed_view_iterator<range_partition>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  range_partition(const value_type &range, std::size_t chunk,
+                  std::size_t remainder, std::size_t count) noexcept
+      : range_(range), chunk_(chunk), remainder_(remainder), count_(count) {}
+
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(count_));
+  }
+
+  value_type operator[](std::size_t idx) const noexcept {
+    return range_.slice(offset_(idx), offset_(idx + 1));
+  }
+
+  bool empty() const noexcept { return count_ == 0; }
+
+  std::size_t size() const noexcept { return count_; }
+
+private:
+  std::size_t offset_(std::size_t idx) const noexcept {
+    if (idx >= count_)
+      return range_.size();
+
+    return std::min(idx * chunk_ + std::min(idx, remainder_), range_.size());
+  }
+
+private:
+  value_type range_;
+  std::size_t chunk_;
+  std::size_t remainder_;
+  std::size_t count_;
+};
+
+// Largest power of two that divides `size`, at most a cache line.
+constexpr std::size_t range_batch_alignment_(std::size_t size) noexcept {
+  std::size_t alignment = 1;
+
+  while (alignment < 64 && size % (alignment * 2) == 0)
+    alignment *= 2;
+
+  return alignment;
+}
+
+// `Width` consecutive values of a range, aligned so that a copy in memory
+// can be loaded as one vector register.
+template <typename Integral, std::size_t Width>
+struct alignas(range_batch_alignment_(sizeof(Integral) * Width)) range_batch
+    : std::array<Integral, Width> {};
+
+// Random-access view of the full batches of a range plus its remainder, the
+// peel-free main/remainder structure of a hand-vectorized loop.
+template <typename Integral, std::size_t Width> struct range_batches {
+  using value_type = range_batch<Integral, Width>;
+
+  using iterator = indexed_view_iterator<range_batches>;
+  using const_iterator = iterator;
+
+  using difference_type = std::ptrdiff_t;
+
+  static_assert(Width > 0, "Width is zero");
+
+  explicit range_batches(const range<Integral> &range) noexcept
+      : range_(range), count_(range.size() / Width) {}
 
-  bool empty() const noexcept { return start_ == stop_; }
+  const_iterator begin() const noexcept { return const_iterator(*this, 0); }
 
-  std::size_t size() const noexcept {
-    return static_cast<std::size_t>((stop_ - start_) / step_);
+  const_iterator end() const noexcept {
+    return const_iterator(*this, static_cast<difference_type>(count_));
   }
 
+  value_type operator[](std::size_t idx) const noexcept {
+    const auto first = range_[idx * Width];
+    const auto step = range_.step();
+
+    value_type batch;
+
+    for (std::size_t lane = 0; lane < Width; ++lane)
+      batch[lane] =
+          range_advance_(first, step, static_cast<std::ptrdiff_t>(lane));
+
+    return batch;
+  }
+
+  // The last range.size() % Width values, which do not fill a batch.
+  range<Integral> tail() const noexcept {
+    return range_.slice(count_ * Width, range_.size());
+  }
+
+  bool empty() const noexcept { return count_ == 0; }
+
+  std::size_t size() const noexcept { return count_; }
+
 private:
-  const value_type start_;
-  const value_type stop_;
-  const value_type step_;
+  range<Integral> range_;
+  std::size_t count_;
 };
 
+} // namespace details
+
 template <typename Int> range(Int) -> range<Int>;
 
 template <typename Int1, typename Int2>
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "range.h"
+
+#include <cstddef>
+
+#if defined(__has_include)
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+#endif
+
+namespace omp {
+
+#ifdef __cpp_lib_experimental_parallel_simd
+// Loads a batch of range::batches() into one lane pack. Kept apart from
+// range.h, since <experimental/simd> costs several times the parse time of
+// everything else that range.h pulls in.
+template <typename Integral, std::size_t Width>
+std::experimental::fixed_size_simd<Integral, Width>
+simd(const details::range_batch<Integral, Width> &batch) noexcept {
+  return std::experimental::fixed_size_simd<Integral, Width>(
+      batch.data(), std::experimental::element_aligned);
+}
+#endif
+
+} // namespace omp
@@ -0,0 +1,396 @@
+#pragma once
+
+#include "zip.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace omp {
+namespace details {
+
+// Allocates every buffer on an `Alignment` boundary, a cache line by default,
+// so that vector loads of a column never straddle two lines at its start.
+template <typename T, std::size_t Alignment = 64> struct aligned_allocator {
+  using value_type = T;
+
+  static_assert(Alignment >= alignof(T), "Alignment is too small");
+
+  template <typename U> struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() noexcept = default;
+
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Alignment> &) noexcept {}
+
+  T *allocate(std::size_t size) {
+    return static_cast<T *>(
+        ::operator new(size * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T *data, std::size_t) noexcept {
+    ::operator delete(data, std::align_val_t(Alignment));
+  }
+
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Alignment> &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const aligned_allocator<U, Alignment> &) const noexcept {
+    return false;
+  }
+};
+
+// Contiguous view of one column of a soa_vector.
+template <typename T> struct column_span {
+  using value_type = std::remove_const_t<T>;
+
+  using iterator = T *;
+  using const_iterator = T *;
+
+  column_span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+  iterator begin() const noexcept { return data_; }
+
+  iterator end() const noexcept { return data_ + size_; }
+
+  T &operator[](std::size_t idx) const noexcept { return data_[idx]; }
+
+  T *data() const noexcept { return data_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  T *data_;
+  std::size_t size_;
+};
+
+} // namespace details
+
+// Structure of arrays: every field lives in its own aligned, contiguous
+// buffer, and all the buffers always hold the same number of elements.
+// Iterating yields zip references to whole records, column<Idx>() gives
+// direct access to a single field.
+template <typename... Ts> class soa_vector {
+public:
+  using value_type = details::zip_value<Ts...>;
+
+  using reference = const details::zip_reference<Ts &...>;
+  using const_reference = const details::zip_reference<const Ts &...>;
+
+  using iterator = details::zip_lockstep_iterator<Ts *...>;
+  using const_iterator = details::zip_lockstep_iterator<const Ts *...>;
+
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <std::size_t Idx>
+  using column_type = std::tuple_element_t<Idx, std::tuple<Ts...>>;
+
+  static_assert(sizeof...(Ts) > 0, "Field count is zero");
+
+  soa_vector() = default;
+
+  explicit soa_vector(size_type size) { resize(size); }
+
+  iterator begin() noexcept { return begin_(indices_()); }
+
+  iterator end() noexcept { return begin() + size_(); }
+
+  const_iterator begin() const noexcept { return begin_(indices_()); }
+
+  const_iterator end() const noexcept { return begin() + size_(); }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+
+  const_iterator cend() const noexcept { return end(); }
+
+  reference operator[](size_type idx) noexcept { return begin()[size_(idx)]; }
+
+  const_reference operator[](size_type idx) const noexcept {
+    return begin()[size_(idx)];
+  }
+
+  reference at(size_type idx) {
+    if (idx >= size())
+      throw std::out_of_range("invalid soa_vector index");
+
+    return (*this)[idx];
+  }
+
+  const_reference at(size_type idx) const {
+    if (idx >= size())
+      throw std::out_of_range("invalid soa_vector index");
+
+    return (*this)[idx];
+  }
+
+  template <std::size_t Idx>
+  details::column_span<column_type<Idx>> column() noexcept {
+    auto &buffer = std::get<Idx>(columns_);
+
+    return {buffer.data(), buffer.size()};
+  }
+
+  template <std::size_t Idx>
+  details::column_span<const column_type<Idx>> column() const noexcept {
+    const auto &buffer = std::get<Idx>(columns_);
+
+    return {buffer.data(), buffer.size()};
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept { return std::get<0>(columns_).size(); }
+
+  size_type capacity() const noexcept {
+    return std::apply(
+        [](const auto &...buffers) {
+          return std::min({buffers.capacity()...});
+        },
+        columns_);
+  }
+
+  void reserve(size_type capacity) {
+    omp::tuple_for_each([capacity](auto &buffer) { buffer.reserve(capacity); },
+                        columns_);
+  }
+
+  void resize(size_type size) {
+    resize_([size](auto &buffer, auto) { buffer.resize(size); });
+  }
+
+  void resize(size_type size, const Ts &...values) {
+    const auto fields = std::forward_as_tuple(values...);
+
+    resize_([size, &fields](auto &buffer, auto idx) {
+      buffer.resize(size, std::get<decltype(idx)::value>(fields));
+    });
+  }
+
+  void clear() noexcept {
+    omp::tuple_for_each([](auto &buffer) { buffer.clear(); }, columns_);
+  }
+
+  // Appends one record, one argument per field. When a column throws, the
+  // columns that already grew are shrunk back, so all of them keep the same
+  // size.
+  template <typename... Args> void emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Ts),
+                  "Argument count differs from field count");
+
+    emplace_back_(std::forward_as_tuple(std::forward<Args>(args)...),
+                  indices_());
+  }
+
+  void push_back(const Ts &...values) { emplace_back(values...); }
+
+  void push_back(Ts &&...values) { emplace_back(std::move(values)...); }
+
+  void push_back(const value_type &value) {
+    std::apply([this](const auto &...fields) { emplace_back(fields...); },
+               value);
+  }
+
+  void push_back(value_type &&value) {
+    std::apply(
+        [this](auto &...fields) { emplace_back(std::move(fields)...); },
+        static_cast<std::tuple<Ts...> &>(value));
+  }
+
+  void pop_back() {
+    omp::tuple_for_each([](auto &buffer) { buffer.pop_back(); }, columns_);
+  }
+
+private:
+  static constexpr auto indices_() noexcept {
+    return std::index_sequence_for<Ts...>();
+  }
+
+  static difference_type size_(size_type size) noexcept {
+    return static_cast<difference_type>(size);
+  }
+
+  difference_type size_() const noexcept { return size_(size()); }
+
+  template <std::size_t... Idxs>
+  iterator begin_(std::index_sequence<Idxs...>) noexcept {
+    return iterator(std::get<Idxs>(columns_).data()...);
+  }
+
+  template <std::size_t... Idxs>
+  const_iterator begin_(std::index_sequence<Idxs...>) const noexcept {
+    return const_iterator(std::get<Idxs>(columns_).data()...);
+  }
+
+  // Calls `resize` with every column and its index. When a column throws,
+  // the columns that already grew are cut back to the old size, so all of
+  // them keep the same size.
+  template <typename Resize> void resize_(const Resize &resize) {
+    resize_(resize, indices_());
+  }
+
+  template <typename Resize, std::size_t... Idxs>
+  void resize_(const Resize &resize, std::index_sequence<Idxs...>) {
+    const auto old = size_();
+    std::size_t grown = 0;
+
+    try {
+      (..., (resize(std::get<Idxs>(columns_),
+                    std::integral_constant<std::size_t, Idxs>()),
+             ++grown));
+    } catch (...) {
+      (..., (Idxs < grown ? shrink_(std::get<Idxs>(columns_), old) : void()));
+      throw;
+    }
+  }
+
+  // Erases rather than resizes, which needs no default constructor.
+  template <typename Buffer>
+  static void shrink_(Buffer &buffer, difference_type size) noexcept {
+    buffer.erase(buffer.begin() + size, buffer.end());
+  }
+
+  template <typename Args, std::size_t... Idxs>
+  void emplace_back_(Args &&args, std::index_sequence<Idxs...>) {
+    std::size_t grown = 0;
+
+    try {
+      (..., (std::get<Idxs>(columns_).emplace_back(
+                 std::forward<std::tuple_element_t<Idxs, Args>>(
+                     std::get<Idxs>(args))),
+             ++grown));
+    } catch (...) {
+      (..., (Idxs < grown ? std::get<Idxs>(columns_).pop_back() : void()));
+      throw;
+    }
+  }
+
+private:
+  std::tuple<std::vector<Ts, details::aligned_allocator<Ts>>...> columns_;
+};
+
+namespace details {
+
+template <typename Record,
+          typename = std::make_index_sequence<field_count_v<Record>>>
+struct soa_vector_of_;
+
+template <typename Record, std::size_t... Idxs>
+struct soa_vector_of_<Record, std::index_sequence<Idxs...>> {
+  using fields_type = decltype(omp::fields(std::declval<Record &>()));
+
+  using type =
+      soa_vector<std::decay_t<std::tuple_element_t<Idxs, fields_type>>...>;
+};
+
+// Records transposed at a time. A block of records stays in cache while each
+// of its fields is copied, so every column is still written sequentially
+// without the records being read from memory once per field.
+constexpr std::size_t transpose_block_ = 256;
+
+template <typename Value, typename Target>
+void transpose_one_(std::true_type, Value &value, Target &target) {
+  target = std::move(value);
+}
+
+template <typename Value, typename Target>
+void transpose_one_(std::false_type, Value &value, Target &target) {
+  target = value;
+}
+
+template <typename Move, typename Records, typename Soa, std::size_t... Idxs>
+void aos_to_soa_(Move move, Records first, Soa &soa,
+                 std::index_sequence<Idxs...>) {
+  const auto size = soa.size();
+
+  for (std::size_t start = 0; start < size; start += transpose_block_) {
+    const auto stop = std::min(size, start + transpose_block_);
+
+    (..., [&] {
+      auto column = soa.template column<Idxs>();
+
+      for (auto idx = start; idx < stop; ++idx) {
+        auto &&record = first[static_cast<std::ptrdiff_t>(idx)];
+
+        transpose_one_(move, std::get<Idxs>(omp::fields(record)), column[idx]);
+      }
+    }());
+  }
+}
+
+template <typename Move, typename Soa, typename Records, std::size_t... Idxs>
+void soa_to_aos_(Move move, Soa &soa, Records &records,
+                 std::index_sequence<Idxs...>) {
+  const auto size = soa.size();
+
+  for (std::size_t start = 0; start < size; start += transpose_block_) {
+    const auto stop = std::min(size, start + transpose_block_);
+
+    (..., [&] {
+      auto column = soa.template column<Idxs>();
+
+      for (auto idx = start; idx < stop; ++idx)
+        transpose_one_(move, column[idx],
+                       std::get<Idxs>(omp::fields(records[idx])));
+    }());
+  }
+}
+
+} // namespace details
+
+// soa_vector with one column per field of the aggregate `Record`.
+template <typename Record>
+using soa_vector_of_t = typename details::soa_vector_of_<Record>::type;
+
+// Transposes a random access range of aggregate records into a soa_vector,
+// one column per field, in the order of declaration. The fields are moved
+// when the range is an rvalue, copied otherwise.
+template <typename Records> auto aos_to_soa(Records &&records) {
+  using std::begin;
+  using std::end;
+
+  auto first = begin(records);
+  const auto size = static_cast<std::size_t>(end(records) - first);
+
+  using record = std::remove_cv_t<std::remove_reference_t<decltype(*first)>>;
+
+  soa_vector_of_t<record> soa(size);
+
+  details::aos_to_soa_(
+      std::bool_constant<!std::is_lvalue_reference_v<Records> &&
+                         !std::is_const_v<std::remove_reference_t<Records>>>(),
+      first, soa, std::make_index_sequence<field_count_v<record>>());
+
+  return soa;
+}
+
+// Transposes a soa_vector back into aggregate records whose fields match its
+// columns. The values are moved when `soa` is an rvalue, copied otherwise.
+template <typename Record, typename Soa>
+std::vector<Record> soa_to_aos(Soa &&soa) {
+  static_assert(std::is_same_v<soa_vector_of_t<Record>, std::decay_t<Soa>>,
+                "Fields differ from the columns");
+
+  std::vector<Record> records(soa.size());
+
+  details::soa_to_aos_(
+      std::bool_constant<!std::is_lvalue_reference_v<Soa> &&
+                         !std::is_const_v<std::remove_reference_t<Soa>>>(),
+      soa, records, std::make_index_sequence<field_count_v<Record>>());
+
+  return records;
+}
+
+} // namespace omp
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace omp {
+namespace details {
+
+template <std::size_t Start, typename Sequence> struct static_range_tuple;
+
+template <std::size_t Start, std::size_t... Idxs>
+struct static_range_tuple<Start, std::index_sequence<Idxs...>> {
+  using type = std::tuple<std::integral_constant<std::size_t, Start + Idxs>...>;
+};
+
+template <std::size_t Start, std::size_t Stop>
+using static_range_tuple_t =
+    typename static_range_tuple<Start,
+                                std::make_index_sequence<Stop - Start>>::type;
+
+template <std::size_t Start, std::size_t... Idxs, typename Callable>
+constexpr void static_for_each_(std::index_sequence<Idxs...>,
+                                Callable &&call) {
+  (call(std::integral_constant<std::size_t, Start + Idxs>()), ...);
+}
+
+} // namespace details
+
+// Indices [Start, Stop) known at compile time. Each index is a distinct
+// std::integral_constant, so it can be used as a template argument inside the
+// loop body (std::get<i>, std::array<T, i>, ...).
+//
+// The range is a tuple of its indices: it works with structured bindings and
+// can be passed to omp::tuple_map/omp::tuple_reduce next to other tuples.
+template <std::size_t Start, std::size_t Stop>
+struct static_range : details::static_range_tuple_t<Start, Stop> {
+  static_assert(Start <= Stop, "Start is greater than stop");
+
+  using value_type = std::size_t;
+
+  static constexpr bool empty() noexcept { return Start == Stop; }
+
+  static constexpr std::size_t size() noexcept { return Stop - Start; }
+
+  // Calls `call` once per index, in order, as a fully unrolled sequence.
+  template <typename Callable>
+  static constexpr void for_each(Callable &&call) {
+    details::static_for_each_<Start>(std::make_index_sequence<size()>(),
+                                     std::forward<Callable>(call));
+  }
+};
+
+} // namespace omp
+
+namespace std {
+
+template <std::size_t Start, std::size_t Stop>
+struct tuple_size<omp::static_range<Start, Stop>>
+    : std::integral_constant<std::size_t, Stop - Start> {};
+
+template <std::size_t Idx, std::size_t Start, std::size_t Stop>
+struct tuple_element<Idx, omp::static_range<Start, Stop>> {
+  using type = std::integral_constant<std::size_t, Start + Idx>;
+};
+
+} // namespace std
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace omp {
+
+class thread_pool;
+
+namespace details {
+
+struct worker_queue_ {
+  std::mutex mutex;
+  std::deque<std::function<void()>> tasks;
+};
+
+struct worker_identity_ {
+  const thread_pool *pool{};
+  std::size_t index{};
+};
+
+inline worker_identity_ &current_worker_() noexcept {
+  static thread_local worker_identity_ identity;
+  return identity;
+}
+
+} // namespace details
+
+// Work-stealing thread pool. Every worker owns a deque: it pushes and pops
+// its own tasks at the back, idle workers steal from the front of the others.
+// Tasks submitted from threads outside the pool go through a shared queue.
+//
+// A worker that waits for a task it spawned keeps executing other tasks
+// meanwhile, so nested fork-join parallelism cannot deadlock the pool.
+class thread_pool {
+public:
+  explicit thread_pool(
+      std::size_t threads = std::thread::hardware_concurrency())
+      : queues_(std::max<std::size_t>(threads, 1)) {
+    workers_.reserve(queues_.size());
+
+    for (std::size_t idx = 0; idx < queues_.size(); ++idx)
+      workers_.emplace_back([this, idx] { work_(idx); });
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stopping_ = true;
+    }
+
+    wake_.notify_all();
+
+    for (auto &worker : workers_)
+      worker.join();
+  }
+
+  std::size_t size() const noexcept { return queues_.size(); }
+
+  // True when called from one of the workers of this pool.
+  bool in_worker() const noexcept {
+    return details::current_worker_().pool == this;
+  }
+
+  // Queues a task: on the calling worker's own deque when called from inside
+  // the pool, on the shared queue otherwise.
+  void submit(std::function<void()> task) {
+    // Counted before it is visible, so the counter never drops below zero.
+    ++queued_;
+
+    if (in_worker()) {
+      auto &queue = queues_[details::current_worker_().index];
+
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.push_back(std::move(task));
+    } else {
+      std::lock_guard<std::mutex> lock(shared_.mutex);
+      shared_.tasks.push_back(std::move(task));
+    }
+
+    if (sleeping_.load()) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      wake_.notify_one();
+    }
+  }
+
+  // Runs `call` on a worker and blocks until it returns, rethrowing whatever
+  // it throws. From inside the pool it simply runs inline.
+  template <typename Callable> void run(Callable &&call) {
+    if (in_worker()) {
+      call();
+      return;
+    }
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    std::exception_ptr error;
+
+    submit([&] {
+      try {
+        call();
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      done = true;
+      finished.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] { return done; });
+
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  // True when the calling worker has no queued tasks of its own, which means
+  // everything it spawned has already been stolen and other workers are
+  // looking for more.
+  bool local_empty() const noexcept {
+    if (!in_worker())
+      return true;
+
+    auto &queue = queues_[details::current_worker_().index];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    return queue.tasks.empty();
+  }
+
+  // Blocks until `done` is set. Workers execute other tasks while waiting,
+  // other threads should prefer run() over spinning here.
+  void wait(const std::atomic<bool> &done) {
+    if (!in_worker()) {
+      while (!done.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+      return;
+    }
+
+    const auto index = details::current_worker_().index;
+
+    while (!done.load(std::memory_order_acquire)) {
+      if (auto task = take_(index))
+        (*task)();
+      else
+        std::this_thread::yield();
+    }
+  }
+
+  // Pool shared by the parallel algorithms when none is given explicitly.
+  static thread_pool &global() {
+    static thread_pool pool;
+    return pool;
+  }
+
+private:
+  static std::optional<std::function<void()>>
+  pop_(details::worker_queue_ &queue, bool back) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty())
+      return std::nullopt;
+
+    std::optional<std::function<void()>> task;
+
+    if (back) {
+      task.emplace(std::move(queue.tasks.back()));
+      queue.tasks.pop_back();
+    } else {
+      task.emplace(std::move(queue.tasks.front()));
+      queue.tasks.pop_front();
+    }
+
+    return task;
+  }
+
+  // Own deque first (newest task, still hot in cache), then the shared
+  // queue, then the oldest task of another worker, which is the largest one
+  // under recursive splitting.
+  std::optional<std::function<void()>> take_(std::size_t index) {
+    auto task = pop_(queues_[index], true);
+
+    if (!task)
+      task = pop_(shared_, false);
+
+    for (std::size_t step = 1; !task && step < queues_.size(); ++step)
+      task = pop_(queues_[(index + step) % queues_.size()], false);
+
+    if (task)
+      --queued_;
+
+    return task;
+  }
+
+  void work_(std::size_t index) {
+    details::current_worker_() = {this, index};
+
+    while (true) {
+      if (auto task = take_(index)) {
+        (*task)();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+
+      ++sleeping_;
+      wake_.wait(lock, [this] { return stopping_ || queued_.load() != 0; });
+      --sleeping_;
+
+      if (stopping_)
+        return;
+    }
+  }
+
+private:
+  mutable std::vector<details::worker_queue_> queues_;
+  details::worker_queue_ shared_;
+
+  std::atomic<std::size_t> queued_{0};
+  std::atomic<std::size_t> sleeping_{0};
+
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stopping_{false};
+
+  std::vector<std::thread> workers_;
+};
+
+} // namespace omp
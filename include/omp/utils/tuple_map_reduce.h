@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace omp {
@@ -64,6 +65,134 @@ constexpr auto tuple_reduce_(std::index_sequence<Idxs...>, Callable &&call,
   return initial;
 }
 
+template <typename... Tuples>
+using tuple_indices_ = std::make_index_sequence<std::tuple_size_v<
+    std::remove_reference_t<decltype(first_type_<Tuples...>())>>>;
+
+template <std::size_t Idx, typename Callable, typename... Tuples>
+constexpr bool map_one_noexcept() {
+  return noexcept(
+      std::declval<Callable &>()(std::get<Idx>(std::declval<Tuples>())...));
+}
+
+template <std::size_t Idx, typename Callable, typename... Tuples>
+constexpr bool map_one_indexed_noexcept() {
+  return noexcept(std::declval<Callable &>()(
+      std::integral_constant<std::size_t, Idx>(),
+      std::get<Idx>(std::declval<Tuples>())...));
+}
+
+template <typename Callable, typename... Tuples, std::size_t... Idxs>
+constexpr bool for_each_noexcept_(std::index_sequence<Idxs...>) {
+  return (... && map_one_noexcept<Idxs, Callable, Tuples...>());
+}
+
+template <typename Callable, typename... Tuples, std::size_t... Idxs>
+constexpr bool for_each_indexed_noexcept_(std::index_sequence<Idxs...>) {
+  return (... && map_one_indexed_noexcept<Idxs, Callable, Tuples...>());
+}
+
+template <std::size_t Idx, typename Callable, typename... Tuples>
+constexpr void map_one_indexed(Callable &call, Tuples &&...tups) {
+  call(std::integral_constant<std::size_t, Idx>(),
+       std::get<Idx>(std::forward<Tuples>(tups))...);
+}
+
+template <std::size_t... Idxs, typename Callable, typename... Tuples>
+constexpr void tuple_for_each_(std::index_sequence<Idxs...>, Callable &call,
+                               Tuples &&...tups) {
+  (..., static_cast<void>(map_one<Idxs>(call, std::forward<Tuples>(tups)...)));
+}
+
+template <std::size_t... Idxs, typename Callable, typename... Tuples>
+constexpr void tuple_for_each_indexed_(std::index_sequence<Idxs...>,
+                                       Callable &call, Tuples &&...tups) {
+  (..., map_one_indexed<Idxs>(call, std::forward<Tuples>(tups)...));
+}
+
+// Stands for any field when probing how many initializers an aggregate takes.
+struct any_field_ {
+  template <typename T> constexpr operator T() const noexcept;
+};
+
+template <typename T, typename Indices, typename = void>
+struct aggregate_takes_ : std::false_type {};
+
+template <typename T, std::size_t... Idxs>
+struct aggregate_takes_<
+    T, std::index_sequence<Idxs...>,
+    std::void_t<decltype(T{(static_cast<void>(Idxs), any_field_())...})>>
+    : std::true_type {};
+
+constexpr std::size_t max_field_count_ = 16;
+
+template <typename T, std::size_t Count = max_field_count_>
+constexpr std::size_t field_count_() {
+  using indices = std::make_index_sequence<Count>;
+
+  if constexpr (!std::is_aggregate_v<T>)
+    return 0;
+  else if constexpr (Count == 0 || aggregate_takes_<T, indices>::value)
+    return Count;
+  else
+    return field_count_<T, Count - 1>();
+}
+
+template <std::size_t... Idxs, typename Predicate, typename... Tuples>
+constexpr bool tuple_any_(std::index_sequence<Idxs...>, Predicate &&pred,
+                          Tuples &&...tups) {
+  return (... || static_cast<bool>(map_one<Idxs>(
+                     std::forward<Predicate>(pred),
+                     std::forward<Tuples>(tups)...)));
+}
+
+template <std::size_t... Idxs, typename Predicate, typename... Tuples>
+constexpr bool tuple_all_(std::index_sequence<Idxs...>, Predicate &&pred,
+                          Tuples &&...tups) {
+  return (... && static_cast<bool>(map_one<Idxs>(
+                     std::forward<Predicate>(pred),
+                     std::forward<Tuples>(tups)...)));
+}
+
+template <std::size_t Idx, typename Callable, typename Predicate,
+          typename Value, typename... Tuples>
+constexpr bool reduce_one_until(Callable &&call, Predicate &&done,
+                                Value &value, Tuples &&...tups) {
+  reduce_one<Idx>(std::forward<Callable>(call), value,
+                  std::forward<Tuples>(tups)...);
+
+  return static_cast<bool>(done(std::as_const(value)));
+}
+
+template <std::size_t... Idxs, typename Callable, typename Predicate,
+          typename Value, typename... Tuples>
+constexpr auto tuple_reduce_until_(std::index_sequence<Idxs...>,
+                                   Callable &&call, Predicate &&done,
+                                   Value initial, Tuples &&...tups) {
+  static_cast<void>(
+      done(std::as_const(initial)) ||
+      (... || reduce_one_until<Idxs>(std::forward<Callable>(call),
+                                     std::forward<Predicate>(done), initial,
+                                     std::forward<Tuples>(tups)...)));
+
+  return initial;
+}
+
+// Reduces the elements [First, Last) by halves: call(left half, right half).
+template <std::size_t First, std::size_t Last, typename Callable,
+          typename Tuple>
+constexpr auto tuple_reduce_tree_(Callable &call, Tuple &&tup) {
+  if constexpr (Last - First == 1) {
+    return std::get<First>(std::forward<Tuple>(tup));
+  } else {
+    constexpr auto Middle = First + (Last - First) / 2;
+
+    return call(
+        tuple_reduce_tree_<First, Middle>(call, std::forward<Tuple>(tup)),
+        tuple_reduce_tree_<Middle, Last>(call, std::forward<Tuple>(tup)));
+  }
+}
+
 } // namespace details
 
 template <
@@ -94,4 +223,171 @@ constexpr auto tuple_reduce(Callable &&call, Value &&initial,
       std::forward<Tuples>(tups)...);
 }
 
+// Number of fields of an aggregate, found by counting how many initializers
+// it takes, 0 for other types. Aggregates with array members are counted
+// wrong, since brace elision spreads initializers over the array elements,
+// and aggregates with more than 16 fields are not supported.
+template <typename Record>
+constexpr std::size_t field_count_v = details::field_count_<Record>();
+
+// Tuple of references to the fields of an aggregate, in declaration order.
+// This is the opt-in that lets plain structs go through tuple_map,
+// tuple_reduce and the other tuple algorithms:
+//
+//   omp::tuple_for_each([](auto &field) { field = {}; }, omp::fields(rec));
+template <typename Record> constexpr auto fields(Record &record) noexcept {
+  constexpr auto count = field_count_v<std::remove_cv_t<Record>>;
+
+  static_assert(std::is_aggregate_v<std::remove_cv_t<Record>>,
+                "Type is not an aggregate");
+  static_assert(count > 0, "Aggregate has no fields");
+
+  if constexpr (count == 1) {
+    auto &[a] = record;
+    return std::tie(a);
+  } else if constexpr (count == 2) {
+    auto &[a, b] = record;
+    return std::tie(a, b);
+  } else if constexpr (count == 3) {
+    auto &[a, b, c] = record;
+    return std::tie(a, b, c);
+  } else if constexpr (count == 4) {
+    auto &[a, b, c, d] = record;
+    return std::tie(a, b, c, d);
+  } else if constexpr (count == 5) {
+    auto &[a, b, c, d, e] = record;
+    return std::tie(a, b, c, d, e);
+  } else if constexpr (count == 6) {
+    auto &[a, b, c, d, e, f] = record;
+    return std::tie(a, b, c, d, e, f);
+  } else if constexpr (count == 7) {
+    auto &[a, b, c, d, e, f, g] = record;
+    return std::tie(a, b, c, d, e, f, g);
+  } else if constexpr (count == 8) {
+    auto &[a, b, c, d, e, f, g, h] = record;
+    return std::tie(a, b, c, d, e, f, g, h);
+  } else if constexpr (count == 9) {
+    auto &[a, b, c, d, e, f, g, h, i] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i);
+  } else if constexpr (count == 10) {
+    auto &[a, b, c, d, e, f, g, h, i, j] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j);
+  } else if constexpr (count == 11) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k);
+  } else if constexpr (count == 12) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k, l] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k, l);
+  } else if constexpr (count == 13) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k, l, m] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m);
+  } else if constexpr (count == 14) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n);
+  } else if constexpr (count == 15) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o);
+  } else if constexpr (count == 16) {
+    auto &[a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p] = record;
+    return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+  }
+}
+
+template <typename Record> void fields(const Record &&) = delete;
+
+// Calls `call` with the I-th element of every tuple, for every I in order,
+// and discards the results. Nothing is stored, so the callable may return
+// void and mutate the elements in place.
+template <
+    typename Callable, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+constexpr void tuple_for_each(Callable &&call, Tuples &&...tups) noexcept(
+    details::for_each_noexcept_<Callable, Tuples...>(
+        details::tuple_indices_<Tuples...>())) {
+  details::tuple_for_each_(details::tuple_indices_<Tuples...>(), call,
+                           std::forward<Tuples>(tups)...);
+}
+
+// Same, with the position of the elements passed first as a
+// std::integral_constant, so it can index other tuples at compile time.
+template <
+    typename Callable, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+constexpr void
+tuple_for_each_indexed(Callable &&call, Tuples &&...tups) noexcept(
+    details::for_each_indexed_noexcept_<Callable, Tuples...>(
+        details::tuple_indices_<Tuples...>())) {
+  details::tuple_for_each_indexed_(details::tuple_indices_<Tuples...>(), call,
+                                   std::forward<Tuples>(tups)...);
+}
+
+// Reduces the elements of `tup` pairwise in a balanced binary tree, e.g.
+// call(call(e0, e1), call(e2, e3)), instead of folding them left to right.
+// The calls of one level do not depend on each other, so they can overlap,
+// and the rounding error of floating-point sums grows with the depth of the
+// tree, log2 of the size, rather than with the size. The tuple must not be
+// empty.
+template <typename Callable, typename Tuple,
+          std::enable_if_t<details::support_get_<Tuple>(), int> = 0>
+constexpr auto tuple_reduce_tree(Callable &&call, Tuple &&tup) {
+  constexpr auto size = std::tuple_size_v<std::remove_reference_t<Tuple>>;
+
+  static_assert(size > 0, "Tuple is empty");
+
+  return details::tuple_reduce_tree_<0, size>(call, std::forward<Tuple>(tup));
+}
+
+// True when `pred` holds for some element, i.e. pred(get<I>(tups)...) for
+// some I. The elements are tested in order and the first match ends the test,
+// like a chain of ||.
+template <
+    typename Predicate, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+constexpr bool tuple_any(Predicate &&pred, Tuples &&...tups) {
+  using FirstTuple =
+      std::remove_reference_t<decltype(details::first_type_<Tuples...>())>;
+  return details::tuple_any_(
+      std::make_index_sequence<std::tuple_size_v<FirstTuple>>(),
+      std::forward<Predicate>(pred), std::forward<Tuples>(tups)...);
+}
+
+// True when `pred` holds for every element. The first mismatch ends the
+// test, like a chain of &&.
+template <
+    typename Predicate, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+constexpr bool tuple_all(Predicate &&pred, Tuples &&...tups) {
+  using FirstTuple =
+      std::remove_reference_t<decltype(details::first_type_<Tuples...>())>;
+  return details::tuple_all_(
+      std::make_index_sequence<std::tuple_size_v<FirstTuple>>(),
+      std::forward<Predicate>(pred), std::forward<Tuples>(tups)...);
+}
+
+// Same as tuple_reduce, but returns as soon as `done` holds for the
+// accumulated value, the initial one included. The remaining elements are
+// not visited.
+template <
+    typename Callable, typename Predicate, typename Value, typename... Tuples,
+    std::enable_if_t<sizeof...(Tuples) && details::support_get_<Tuples...>() &&
+                         details::same_size_<Tuples...>(),
+                     int> = 0>
+constexpr auto tuple_reduce_until(Callable &&call, Predicate &&done,
+                                  Value &&initial, Tuples &&...tups) {
+  using FirstTuple =
+      std::remove_reference_t<decltype(details::first_type_<Tuples...>())>;
+  return details::tuple_reduce_until_(
+      std::make_index_sequence<std::tuple_size_v<FirstTuple>>(),
+      std::forward<Callable>(call), std::forward<Predicate>(done),
+      std::forward<Value>(initial), std::forward<Tuples>(tups)...);
+}
+
 } // namespace omp
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "zip.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace omp {
+namespace details {
+
+// Elements moved to the outputs at a time. Each output column is written for
+// a whole block before the next one, so the writes stay sequential.
+constexpr std::size_t unzip_block_ = 256;
+
+template <typename View, typename = void>
+struct has_view_size_ : std::false_type {};
+
+template <typename View>
+struct has_view_size_<View,
+                      std::void_t<decltype(std::size(std::declval<View &>()))>>
+    : std::true_type {};
+
+template <typename Container>
+auto reserve_more_(Container &container, std::size_t size, int)
+    -> decltype(container.reserve(size), void()) {
+  container.reserve(container.size() + size);
+}
+
+template <typename Container>
+void reserve_more_(Container &, std::size_t, long) {}
+
+template <std::size_t Idx, typename Element>
+decltype(auto) unzip_get_(Element &&element) {
+  using std::get;
+
+  return get<Idx>(std::forward<Element>(element));
+}
+
+// Random access views are read once per column, which for a zip over
+// containers is a sequential read of the matching input column.
+template <typename Iterator, typename... Outputs, std::size_t... Idxs>
+void unzip_block_direct_(Iterator first, std::ptrdiff_t size,
+                         std::index_sequence<Idxs...>, Outputs &...outs) {
+  (..., [&] {
+    for (std::ptrdiff_t idx = 0; idx < size; ++idx)
+      outs.push_back(unzip_get_<Idxs>(first[idx]));
+  }());
+}
+
+// Other views are walked once: a block of elements is buffered, then every
+// column is moved out of the buffer.
+template <typename Buffer, typename... Outputs, std::size_t... Idxs>
+void unzip_block_buffered_(Buffer &buffer, std::index_sequence<Idxs...>,
+                           Outputs &...outs) {
+  (..., [&] {
+    for (auto &element : buffer)
+      outs.push_back(unzip_get_<Idxs>(std::move(element)));
+  }());
+}
+
+template <template <typename...> class Container, typename Value,
+          std::size_t... Idxs>
+auto unzip_columns_(std::index_sequence<Idxs...>) {
+  return std::tuple<
+      Container<std::decay_t<std::tuple_element_t<Idxs, Value>>>...>();
+}
+
+} // namespace details
+
+// Appends member Idx of every element of `view` to the Idx-th output, like
+// zip run backwards. The outputs reserve their room once when the size of the
+// view is known and the view is processed in blocks, so that each output is
+// filled sequentially. Members the view hands out by value are moved, members
+// it refers to, like those of a zip over containers, are copied.
+template <typename View, typename... Outputs>
+void unzip_into(View &&view, Outputs &...outs) {
+  using std::begin;
+  using std::end;
+
+  auto first = begin(view);
+  auto last = end(view);
+
+  using iterator = decltype(first);
+  using traits = std::iterator_traits<iterator>;
+  using element = std::remove_cv_t<std::remove_reference_t<
+      typename traits::reference>>;
+
+  static_assert(std::tuple_size_v<element> == sizeof...(Outputs),
+                "Output count differs from element size");
+
+  constexpr auto indices = std::index_sequence_for<Outputs...>();
+
+  if constexpr (details::all_random_access_v<iterator>) {
+    const auto size = last - first;
+
+    (..., details::reserve_more_(outs, static_cast<std::size_t>(size), 0));
+
+    for (auto left = size; left;) {
+      const auto block = std::min(
+          left, static_cast<decltype(left)>(details::unzip_block_));
+
+      details::unzip_block_direct_(first, block, indices, outs...);
+
+      first += block;
+      left -= block;
+    }
+  } else {
+    if constexpr (details::has_view_size_<View>::value)
+      (..., details::reserve_more_(
+                outs, static_cast<std::size_t>(std::size(view)), 0));
+
+    std::vector<typename traits::value_type> buffer;
+    buffer.reserve(details::unzip_block_);
+
+    while (first != last) {
+      for (; first != last && buffer.size() < details::unzip_block_; ++first)
+        buffer.emplace_back(*first);
+
+      details::unzip_block_buffered_(buffer, indices, outs...);
+      buffer.clear();
+    }
+  }
+}
+
+// Splits `view` into a tuple of new containers, one per member:
+//
+//   auto [keys, values] = omp::unzip<std::vector>(omp::zip(lhs, rhs));
+template <template <typename...> class Container, typename View>
+auto unzip(View &&view) {
+  using std::begin;
+
+  using value_type = typename std::iterator_traits<decltype(begin(
+      std::declval<View &>()))>::value_type;
+
+  auto columns = details::unzip_columns_<Container, value_type>(
+      std::make_index_sequence<std::tuple_size_v<value_type>>());
+
+  std::apply([&view](auto &...outs) { unzip_into(view, outs...); }, columns);
+
+  return columns;
+}
+
+} // namespace omp
@@ -3,25 +3,22 @@
 #include "base_container_traits.h"
 #include "tuple_map_reduce.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 namespace omp {
 
 namespace details {
 
 namespace functor {
-struct indirection {
-  template <typename Iterator> auto &operator()(Iterator &iter) {
-    return *iter;
-  }
-};
-
-struct increment {
-  template <typename Iterator> auto operator()(Iterator iter) { return ++iter; }
-};
-
-struct are_same {
+struct equal {
   template <typename First, typename Second>
-  bool operator()(bool same, const First &first, const Second &second) {
-    return same || (first == second);
+  bool operator()(const First &first, const Second &second) const {
+    return first == second;
   }
 };
 
@@ -54,75 +51,307 @@ struct cend {
 };
 } // namespace functor
 
-template <typename... Iterators> class zip_iterator {
+// True when every iterator is random access. omp::zip cuts such zips to the
+// shortest member up front, so all members reach their end together and one
+// of them is enough to tell where the zip ends.
+template <typename... Iterators>
+constexpr bool all_random_access_v =
+    sizeof...(Iterators) > 0 &&
+    (... && std::is_base_of_v<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<Iterators>::iterator_category>);
+
+template <typename... References> struct zip_reference;
+
+// Element of a zip held by value, e.g. the temporary of a sorting algorithm.
+// It is a tuple of the values the zipped references refer to, and it moves
+// those values out of a zip_reference when it is built from an rvalue one.
+template <typename... Values> struct zip_value : std::tuple<Values...> {
+  using base = std::tuple<Values...>;
+
+  using base::base;
+
+  zip_value() = default;
+
+  template <typename... References>
+  zip_value(const zip_reference<References...> &refs) : base(refs.refs()) {}
+
+  template <typename... References>
+  zip_value(const zip_reference<References...> &&refs)
+      : zip_value(std::move(refs), std::index_sequence_for<Values...>()) {}
+
+  template <typename... References>
+  zip_value &operator=(const zip_reference<References...> &refs) {
+    base::operator=(refs.refs());
+
+    return *this;
+  }
+
+  template <typename... References>
+  zip_value &operator=(const zip_reference<References...> &&refs) {
+    return *this = zip_value(std::move(refs));
+  }
+
+private:
+  template <typename... References, std::size_t... Idxs>
+  zip_value(const zip_reference<References...> &&refs,
+            std::index_sequence<Idxs...>)
+      : base(std::move(std::get<Idxs>(refs.refs()))...) {}
+};
+
+// What dereferencing a zip_iterator yields: a tuple of the references of the
+// member iterators. Assigning to it and swapping two of them writes through
+// to the zipped containers, which is what lets std::sort and friends reorder
+// several columns together.
+template <typename... References>
+struct zip_reference : std::tuple<References...> {
+  using base = std::tuple<References...>;
+
+  explicit zip_reference(References... refs)
+      : base(std::forward<References>(refs)...) {}
+
+  zip_reference(const zip_reference &) = default;
+
+  const zip_reference &operator=(const zip_reference &rhs) const {
+    assign_(rhs.refs(), std::index_sequence_for<References...>());
+
+    return *this;
+  }
+
+  const zip_reference &operator=(const zip_reference &&rhs) const {
+    move_(rhs.refs(), std::index_sequence_for<References...>());
+
+    return *this;
+  }
+
+  template <typename... Values>
+  const zip_reference &operator=(const zip_value<Values...> &rhs) const {
+    assign_(rhs, std::index_sequence_for<References...>());
+
+    return *this;
+  }
+
+  template <typename... Values>
+  const zip_reference &operator=(zip_value<Values...> &&rhs) const {
+    move_(rhs, std::index_sequence_for<References...>());
+
+    return *this;
+  }
+
+  friend void swap(const zip_reference &lhs, const zip_reference &rhs) {
+    lhs.swap_(rhs, std::index_sequence_for<References...>());
+  }
+
+  const base &refs() const noexcept { return *this; }
+
+private:
+  template <typename Tuple, std::size_t... Idxs>
+  void assign_(const Tuple &rhs, std::index_sequence<Idxs...>) const {
+    (..., (std::get<Idxs>(refs()) = std::get<Idxs>(rhs)));
+  }
+
+  template <typename Tuple, std::size_t... Idxs>
+  void move_(Tuple &&rhs, std::index_sequence<Idxs...>) const {
+    (..., (std::get<Idxs>(refs()) = std::move(std::get<Idxs>(rhs))));
+  }
+
+  template <std::size_t... Idxs>
+  void swap_(const zip_reference &rhs, std::index_sequence<Idxs...>) const {
+    using std::swap;
+
+    (..., swap(std::get<Idxs>(refs()), std::get<Idxs>(rhs.refs())));
+  }
+};
+
+// Everything zip_iterator and zip_lockstep_iterator share. `Lockstep` tells
+// whether the members are known to reach their ends together.
+template <typename Derived, bool Lockstep, typename... Iterators>
+class zip_iterator_base_ {
 public:
-  using iterator_category = std::forward_iterator_tag;
+  using iterator_category =
+      std::conditional_t<all_random_access_v<Iterators...>,
+                         std::random_access_iterator_tag,
+                         std::forward_iterator_tag>;
+
   using difference_type = std::ptrdiff_t;
 
-  using value_type = decltype(omp::tuple_map(
-      functor::indirection(), std::declval<std::tuple<Iterators...> &>()));
+  using value_type =
+      zip_value<typename std::iterator_traits<Iterators>::value_type...>;
 
-  using reference = const value_type;
+  using reference = const zip_reference<
+      typename std::iterator_traits<Iterators>::reference...>;
 
-  template <typename Tuple> struct proxy {
-    proxy(Tuple &&values) noexcept(
-        std::is_nothrow_move_constructible_v<Tuple>())
-        : values(std::move(values)) {}
+  struct pointer {
+    pointer(reference &&values) noexcept : values(std::move(values)) {}
 
-    const auto operator->() const noexcept { return &values; }
+    const auto *operator->() const noexcept { return &values; }
 
-    Tuple values;
+    std::remove_const_t<reference> values;
   };
 
-  using pointer = proxy<value_type>;
+  zip_iterator_base_() = default;
 
-  zip_iterator(Iterators... iterators)
+  zip_iterator_base_(Iterators... iterators)
       : iterators_(std::forward<Iterators>(iterators)...) {}
 
   template <typename... InIterators>
-  zip_iterator(const std::tuple<InIterators...> &iterators)
+  zip_iterator_base_(const std::tuple<InIterators...> &iterators)
       : iterators_(iterators) {}
 
   template <typename... InIterators>
-  zip_iterator(std::tuple<InIterators...> &&iterators)
+  zip_iterator_base_(std::tuple<InIterators...> &&iterators)
       : iterators_(std::move(iterators)) {}
 
-  pointer operator->() const {
-    return omp::tuple_map(functor::indirection(), iterators_);
-  }
+  pointer operator->() const { return **this; }
 
   reference operator*() const {
-    return omp::tuple_map(functor::indirection(), iterators_);
+    return std::apply(
+        [](const auto &...iterators) {
+          return std::remove_const_t<reference>(*iterators...);
+        },
+        iterators_);
   }
 
-  zip_iterator &operator++() {
-    iterators_ = omp::tuple_map(functor::increment(), std::move(iterators_));
+  reference operator[](difference_type diff) const { return *(*this + diff); }
 
-    return *this;
+  Derived &operator++() {
+    omp::tuple_for_each([](auto &iterator) { ++iterator; }, iterators_);
+
+    return derived_();
   }
 
-  zip_iterator operator++(int) {
-    auto temp = *this;
+  Derived operator++(int) {
+    auto temp = derived_();
     ++(*this);
 
     return temp;
   }
 
-  bool operator==(const zip_iterator &rhs) const {
-    return omp::tuple_reduce(functor::are_same(), false, iterators_,
-                             rhs.iterators_);
+  Derived &operator--() {
+    omp::tuple_for_each([](auto &iterator) { --iterator; }, iterators_);
+
+    return derived_();
+  }
+
+  Derived operator--(int) {
+    auto temp = derived_();
+    --(*this);
+
+    return temp;
+  }
+
+  Derived &operator+=(difference_type diff) {
+    omp::tuple_for_each([diff](auto &iterator) { iterator += diff; },
+                        iterators_);
+
+    return derived_();
+  }
+
+  Derived operator+(difference_type diff) const {
+    auto temp = derived_();
+
+    return temp += diff;
+  }
+
+  friend Derived operator+(difference_type diff, const Derived &iter) {
+    return iter + diff;
+  }
+
+  Derived &operator-=(difference_type diff) { return *this += -diff; }
+
+  Derived operator-(difference_type diff) const {
+    auto temp = derived_();
+
+    return temp -= diff;
+  }
+
+  // Random-access members move in lockstep, so the first one measures the
+  // distance for all of them.
+  difference_type operator-(const zip_iterator_base_ &rhs) const {
+    return static_cast<difference_type>(std::get<0>(iterators_) -
+                                        std::get<0>(rhs.iterators_));
+  }
+
+  // The zip ends as soon as any member reaches its end. When the members are
+  // known to end together, the first one is enough to tell.
+  bool operator==(const zip_iterator_base_ &rhs) const {
+    if constexpr (Lockstep)
+      return std::get<0>(iterators_) == std::get<0>(rhs.iterators_);
+    else
+      return omp::tuple_any(functor::equal(), iterators_, rhs.iterators_);
+  }
+
+  bool operator!=(const zip_iterator_base_ &rhs) const {
+    return !(*this == rhs);
   }
 
-  bool operator!=(const zip_iterator &rhs) const { return !(*this == rhs); }
+  bool operator<(const zip_iterator_base_ &rhs) const {
+    return std::get<0>(iterators_) < std::get<0>(rhs.iterators_);
+  }
+
+  bool operator>(const zip_iterator_base_ &rhs) const { return rhs < *this; }
+
+  bool operator<=(const zip_iterator_base_ &rhs) const {
+    return !(*this > rhs);
+  }
+
+  bool operator>=(const zip_iterator_base_ &rhs) const {
+    return !(*this < rhs);
+  }
 
   auto &iterators() { return iterators_; }
 
   const auto &iterators() const { return iterators_; }
 
+private:
+  Derived &derived_() { return static_cast<Derived &>(*this); }
+
+  const Derived &derived_() const {
+    return static_cast<const Derived &>(*this);
+  }
+
 private:
   std::tuple<Iterators...> iterators_;
 };
 
+// Walks several iterators side by side and stops as soon as any of them
+// reaches its end, so ranges of different lengths can be zipped directly.
+template <typename... Iterators>
+class zip_iterator
+    : public zip_iterator_base_<zip_iterator<Iterators...>, false,
+                                Iterators...> {
+  using base =
+      zip_iterator_base_<zip_iterator<Iterators...>, false, Iterators...>;
+
+public:
+  using base::base;
+};
+
+// Random-access zip_iterator whose members are known to reach their ends
+// together, because its end was cut to the shortest member up front. Only
+// the first member is compared, which keeps loops over it countable.
+template <typename... Iterators>
+class zip_lockstep_iterator
+    : public zip_iterator_base_<zip_lockstep_iterator<Iterators...>, true,
+                                Iterators...> {
+  using base = zip_iterator_base_<zip_lockstep_iterator<Iterators...>, true,
+                                  Iterators...>;
+
+public:
+  static_assert(all_random_access_v<Iterators...>,
+                "Iterators are not random access");
+
+  using base::base;
+};
+
+// Iterator of omp::zip: the lockstep one when the zip is cut to its
+// shortest member up front.
+template <typename... Iterators>
+using zip_view_iterator_t =
+    std::conditional_t<all_random_access_v<Iterators...>,
+                       zip_lockstep_iterator<Iterators...>,
+                       zip_iterator<Iterators...>>;
+
 template <typename... Iterators>
 zip_iterator(Iterators... iterators) -> zip_iterator<Iterators...>;
 
@@ -139,9 +368,9 @@ zip_iterator(std::tuple<Iterators...> &&iterators)
 using details::zip_iterator;
 
 template <typename... Containers> struct zip {
-  using iterator =
-      zip_iterator<typename base_container_traits<Containers>::iterator...>;
-  using const_iterator = zip_iterator<
+  using iterator = details::zip_view_iterator_t<
+      typename base_container_traits<Containers>::iterator...>;
+  using const_iterator = details::zip_view_iterator_t<
       typename base_container_traits<Containers>::const_iterator...>;
 
   using value_type = typename iterator::value_type;
@@ -154,7 +383,12 @@ template <typename... Containers> struct zip {
   }
 
   iterator end() {
-    return omp::tuple_map(details::functor::end(), containers_);
+    if constexpr (details::all_random_access_v<typename base_container_traits<
+                      Containers>::iterator...>)
+      return shortest_end_(
+          begin(), omp::tuple_map(details::functor::end(), containers_));
+    else
+      return omp::tuple_map(details::functor::end(), containers_);
   }
 
   const_iterator begin() const {
@@ -162,7 +396,12 @@ template <typename... Containers> struct zip {
   }
 
   const_iterator end() const {
-    return omp::tuple_map(details::functor::cend(), containers_);
+    if constexpr (details::all_random_access_v<typename base_container_traits<
+                      Containers>::const_iterator...>)
+      return shortest_end_(
+          begin(), omp::tuple_map(details::functor::cend(), containers_));
+    else
+      return omp::tuple_map(details::functor::cend(), containers_);
   }
 
   const_iterator cbegin() const { return begin(); }
@@ -173,6 +412,27 @@ template <typename... Containers> struct zip {
 
   const auto &containers() const { return containers_; }
 
+private:
+  // Every member stops after as many elements as the shortest one has.
+  template <typename Iterator, typename Ends>
+  static Iterator shortest_end_(Iterator first, const Ends &ends) {
+    return shortest_end_(std::move(first), ends,
+                         std::index_sequence_for<Containers...>());
+  }
+
+  template <typename Iterator, typename Ends, std::size_t... Idxs>
+  static Iterator shortest_end_(Iterator first, const Ends &ends,
+                                std::index_sequence<Idxs...>) {
+    auto &iterators = first.iterators();
+
+    const auto size = std::min({static_cast<std::ptrdiff_t>(
+        std::get<Idxs>(ends) - std::get<Idxs>(iterators))...});
+
+    (..., (std::get<Idxs>(iterators) += size));
+
+    return first;
+  }
+
 private:
   std::tuple<Containers...> containers_;
 };
@@ -181,3 +441,23 @@ template <typename... Containers>
 zip(Containers &&...containers) -> zip<Containers...>;
 
 } // namespace omp
+
+namespace std {
+
+template <typename... References>
+struct tuple_size<omp::details::zip_reference<References...>>
+    : std::integral_constant<std::size_t, sizeof...(References)> {};
+
+template <std::size_t Idx, typename... References>
+struct tuple_element<Idx, omp::details::zip_reference<References...>>
+    : tuple_element<Idx, std::tuple<References...>> {};
+
+template <typename... Values>
+struct tuple_size<omp::details::zip_value<Values...>>
+    : std::integral_constant<std::size_t, sizeof...(Values)> {};
+
+template <std::size_t Idx, typename... Values>
+struct tuple_element<Idx, omp::details::zip_value<Values...>>
+    : tuple_element<Idx, std::tuple<Values...>> {};
+
+} // namespace std
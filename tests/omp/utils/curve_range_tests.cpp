@@ -0,0 +1,142 @@
+#include "omp/utils/curve_range.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+template <typename Curve> std::vector<std::array<int, 2>> collect(Curve &&r) {
+  std::vector<std::array<int, 2>> result;
+
+  for (auto idx : r)
+    result.emplace_back(idx);
+
+  return result;
+}
+
+std::set<std::array<int, 2>>
+as_set(const std::vector<std::array<int, 2>> &values) {
+  return std::set<std::array<int, 2>>(values.begin(), values.end());
+}
+
+std::set<std::array<int, 2>> grid(int rows, int cols) {
+  std::set<std::array<int, 2>> result;
+
+  for (int i = 0; i < rows; ++i)
+    for (int j = 0; j < cols; ++j)
+      result.insert({i, j});
+
+  return result;
+}
+} // namespace
+
+TEST(omp_curve_range, compact_even_bits) {
+  ASSERT_EQ(omp::details::compact_even_bits_portable_(0b1010101u), 0b1111u);
+  ASSERT_EQ(omp::details::compact_even_bits_portable_(0b0100011u), 0b0001u);
+  ASSERT_EQ(omp::details::compact_even_bits_portable_(~std::uint64_t{0}),
+            0xFFFFFFFFu);
+
+  for (std::uint64_t value : {0ull, 1ull, 0x123456789ABCDEFull, ~0ull})
+    ASSERT_EQ(omp::details::compact_even_bits_(value),
+              omp::details::compact_even_bits_portable_(value));
+}
+
+TEST(omp_curve_range, morton_order) {
+  const std::vector<std::array<int, 2>> expecting = {
+      {0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3},
+      {2, 0}, {2, 1}, {3, 0}, {3, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 3},
+  };
+
+  ASSERT_EQ(collect(omp::morton_range({4, 4})), expecting);
+}
+
+TEST(omp_curve_range, hilbert_order) {
+  const std::vector<std::array<int, 2>> expecting = {
+      {0, 0}, {1, 0}, {1, 1}, {0, 1}, {0, 2}, {0, 3}, {1, 3}, {1, 2},
+      {2, 2}, {2, 3}, {3, 3}, {3, 2}, {3, 1}, {2, 1}, {2, 0}, {3, 0},
+  };
+
+  ASSERT_EQ(collect(omp::hilbert_range({4, 4})), expecting);
+}
+
+TEST(omp_curve_range, iterators_outlive_view) {
+  auto it = std::cbegin(omp::morton_range({4, 4}));
+
+  ASSERT_EQ(*++it, (std::array<int, 2>{0, 1}));
+  ASSERT_EQ(*++it, (std::array<int, 2>{1, 0}));
+
+  auto segment = *std::cbegin(omp::hilbert_range({4, 4}).split(2));
+
+  ASSERT_EQ(*std::cbegin(segment), (std::array<int, 2>{0, 0}));
+}
+
+TEST(omp_curve_range, hilbert_neighbours) {
+  auto result = collect(omp::hilbert_range({16, 16}));
+
+  for (std::size_t i = 1; i < result.size(); ++i)
+    ASSERT_EQ(std::abs(result[i][0] - result[i - 1][0]) +
+                  std::abs(result[i][1] - result[i - 1][1]),
+              1);
+}
+
+TEST(omp_curve_range, covers_once) {
+  for (auto [rows, cols] : {std::array<int, 2>{5, 3}, {1, 7}, {9, 2}, {6, 6}}) {
+    auto morton = collect(omp::morton_range({rows, cols}));
+    auto hilbert = collect(omp::hilbert_range({rows, cols}));
+
+    const auto expecting = grid(rows, cols);
+
+    ASSERT_EQ(morton.size(), expecting.size());
+    ASSERT_EQ(as_set(morton), expecting);
+
+    ASSERT_EQ(hilbert.size(), expecting.size());
+    ASSERT_EQ(as_set(hilbert), expecting);
+  }
+}
+
+TEST(omp_curve_range, empty) {
+  ASSERT_TRUE(collect(omp::morton_range({0, 4})).empty());
+  ASSERT_TRUE(collect(omp::hilbert_range({3, -1})).empty());
+}
+
+TEST(omp_curve_range, extents_too_large) {
+  const std::int64_t fits[2] = {std::int64_t{1} << 31, std::int64_t{1} << 31};
+  const std::int64_t too_large[2] = {std::int64_t{1} << 32,
+                                     std::int64_t{1} << 31};
+
+  ASSERT_EQ(omp::morton_range(fits).curve().size(), std::size_t{1} << 62);
+  ASSERT_THROW(omp::morton_range(too_large), std::logic_error);
+}
+
+TEST(omp_curve_range, split_segments) {
+  auto r = omp::hilbert_range({7, 13});
+  auto parts = r.split(5);
+
+  ASSERT_EQ(parts.size(), 5u);
+
+  std::vector<std::array<int, 2>> result;
+
+  for (auto part : parts)
+    for (auto idx : part)
+      result.emplace_back(idx);
+
+  ASSERT_EQ(result, collect(r));
+}
+
+TEST(omp_curve_range, chunks_segments) {
+  auto r = omp::morton_range({6, 10});
+
+  std::vector<std::array<int, 2>> result;
+
+  for (auto part : r.chunks(7))
+    for (auto idx : part)
+      result.emplace_back(idx);
+
+  ASSERT_EQ(result, collect(r));
+}
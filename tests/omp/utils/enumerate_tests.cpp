@@ -2,8 +2,28 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+namespace {
+// True when both split and chunks can be called on an Enumerate expression.
+template <typename Enumerate, typename = void>
+struct is_splittable : std::false_type {};
+
+template <typename Enumerate>
+struct is_splittable<
+    Enumerate, std::void_t<decltype(std::declval<Enumerate>().split(2)),
+                           decltype(std::declval<Enumerate>().chunks(2))>>
+    : std::true_type {};
+} // namespace
+
 TEST(omp_enumerate, container_iterator_types) {
   std::vector v = {1, 2, 3, 4, 5};
 
@@ -149,3 +169,221 @@ TEST(omp_enumerate, pointers_case) {
        omp::enumerate(std::cbegin(expecting), std::cend(expecting)))
     ASSERT_EQ(idx, value);
 }
+
+TEST(omp_enumerate, iterator_category_propagation) {
+  std::vector<int> v;
+  std::list<int> l;
+  std::forward_list<int> f;
+  int arr[] = {1, 2, 3};
+
+  using vector_category = typename decltype(omp::enumerate(
+      v))::iterator::iterator_category;
+  using list_category = typename decltype(omp::enumerate(
+      l))::iterator::iterator_category;
+  using forward_list_category = typename decltype(omp::enumerate(
+      f))::iterator::iterator_category;
+  using array_category = typename decltype(omp::enumerate(
+      arr))::iterator::iterator_category;
+
+  ASSERT_TRUE(
+      (std::is_same_v<vector_category, std::random_access_iterator_tag>));
+  ASSERT_TRUE(
+      (std::is_same_v<list_category, std::bidirectional_iterator_tag>));
+  ASSERT_TRUE(
+      (std::is_same_v<forward_list_category, std::forward_iterator_tag>));
+  ASSERT_TRUE(
+      (std::is_same_v<array_category, std::random_access_iterator_tag>));
+}
+
+TEST(omp_enumerate, random_access_keeps_index) {
+  std::vector values = {10, 20, 30, 40, 50, 60};
+
+  auto enumeration = omp::enumerate(values, 3);
+
+  auto first = std::cbegin(enumeration);
+  auto last = std::cend(enumeration);
+
+  ASSERT_EQ(last - first, 6);
+  ASSERT_EQ((first + 4)->first, 7);
+  ASSERT_EQ((first + 4)->second, 50);
+  ASSERT_EQ(first[2].first, 5);
+  ASSERT_EQ(first[2].second, 30);
+  ASSERT_EQ((last - 1)->first, 8);
+  ASSERT_EQ(last[-6].first, 3);
+
+  first += 5;
+  first -= 2;
+
+  ASSERT_EQ((*first).first, 6);
+  ASSERT_EQ((*first).second, 40);
+  ASSERT_TRUE(first < last);
+
+  auto found = std::lower_bound(
+      std::cbegin(enumeration), std::cend(enumeration), 35,
+      [](const auto &element, int value) { return element.second < value; });
+
+  ASSERT_EQ(found->first, 6);
+}
+
+TEST(omp_enumerate, reverse_iteration_keeps_index) {
+  std::list values = {0, 1, 2, 3, 4};
+
+  auto enumeration = omp::enumerate(values);
+
+  std::vector<std::ptrdiff_t> indices;
+
+  std::for_each(std::make_reverse_iterator(std::end(enumeration)),
+                std::make_reverse_iterator(std::begin(enumeration)),
+                [&](const auto &element) {
+                  ASSERT_EQ(element.first, element.second);
+                  indices.emplace_back(element.first);
+                });
+
+  const std::vector<std::ptrdiff_t> expecting = {4, 3, 2, 1, 0};
+
+  ASSERT_EQ(indices, expecting);
+}
+
+TEST(omp_enumerate, reference_is_tuple_like) {
+  std::vector values = {3, 4, 5};
+
+  using reference =
+      typename decltype(omp::enumerate(values))::iterator::reference;
+
+  ASSERT_EQ(std::tuple_size_v<reference>, 2u);
+  ASSERT_TRUE((std::is_same_v<std::tuple_element_t<1, reference>, int &>));
+
+  for (auto [idx, value] : omp::enumerate(values))
+    value += static_cast<int>(idx);
+
+  const std::vector expecting = {3, 5, 7};
+
+  ASSERT_EQ(values, expecting);
+
+  auto element = *std::cbegin(omp::enumerate(values, 2));
+
+  ASSERT_EQ(element.get<0>(), 2);
+  ASSERT_EQ(omp::details::get<1>(element), 3);
+
+  const std::pair<const std::ptrdiff_t, const int &> pair = element;
+
+  ASSERT_EQ(pair.first, 2);
+  ASSERT_EQ(&pair.second, values.data());
+}
+
+TEST(omp_enumerate, narrow_index_type) {
+  std::vector<float> values(100);
+
+  auto enumeration = omp::enumerate<std::int32_t>(values, 10);
+
+  using index_type = std::tuple_element_t<
+      0, typename decltype(enumeration)::iterator::reference>;
+
+  ASSERT_TRUE((std::is_same_v<index_type, const std::int32_t>));
+
+  for (auto [idx, value] : enumeration)
+    value = static_cast<float>(idx);
+
+  ASSERT_EQ(values.front(), 10.0f);
+  ASSERT_EQ(values.back(), 109.0f);
+  ASSERT_EQ((std::cend(enumeration) - 1)->first, 109);
+
+  std::int16_t arr[] = {0, 1, 2};
+
+  for (auto [idx, value] : omp::enumerate<std::int8_t>(arr))
+    ASSERT_EQ(idx, value);
+}
+
+TEST(omp_enumerate, narrow_index_type_overflow) {
+  std::vector<int> values(200);
+
+  ASSERT_NO_THROW(omp::enumerate<std::int8_t>(values, -73));
+  ASSERT_THROW(omp::enumerate<std::int8_t>(values, -72), std::logic_error);
+  ASSERT_THROW(omp::enumerate<std::int8_t>(values), std::logic_error);
+  ASSERT_NO_THROW(omp::enumerate<std::uint8_t>(values, 55));
+  ASSERT_THROW(omp::enumerate<std::uint8_t>(values, 56), std::logic_error);
+
+  std::list<int> list(127);
+
+  ASSERT_NO_THROW(omp::enumerate<std::int8_t>(list));
+  ASSERT_THROW(omp::enumerate<std::int8_t>(list, 1), std::logic_error);
+}
+
+TEST(omp_enumerate, split_continues_numbering) {
+  std::vector<int> values(11);
+
+  auto enumeration = omp::enumerate(values, 100);
+  auto parts = enumeration.split(3);
+
+  ASSERT_EQ(parts.size(), 3u);
+
+  const std::vector<std::ptrdiff_t> firsts = {100, 104, 108};
+  const std::vector<std::ptrdiff_t> sizes = {4, 4, 3};
+
+  for (std::size_t i = 0; i < parts.size(); ++i) {
+    auto part = parts[i];
+
+    ASSERT_EQ(std::cbegin(part)->first, firsts[i]);
+    ASSERT_EQ(std::cend(part) - std::cbegin(part), sizes[i]);
+
+    for (auto [idx, value] : part)
+      value = static_cast<int>(idx);
+  }
+
+  for (std::size_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(values[i], static_cast<int>(i) + 100);
+}
+
+TEST(omp_enumerate, chunks_continue_numbering) {
+  const int values[] = {0, 1, 2, 3, 4, 5, 6};
+
+  auto parts = omp::enumerate<std::int16_t>(values).chunks(3);
+
+  ASSERT_EQ(parts.size(), 3u);
+
+  std::vector<int> seen;
+
+  for (auto part : parts)
+    for (auto [idx, value] : part) {
+      ASSERT_EQ(idx, value);
+      seen.emplace_back(value);
+    }
+
+  ASSERT_EQ(seen.size(), 7u);
+  ASSERT_EQ((std::cend(parts[2]) - 1)->first, 6);
+
+  auto owning = omp::enumerate(std::vector<int>{});
+
+  ASSERT_TRUE(owning.chunks(4).empty());
+  ASSERT_THROW(omp::enumerate(values).split(0), std::logic_error);
+}
+
+TEST(omp_enumerate, split_temporaries) {
+  using owning = decltype(omp::enumerate(std::vector<int>{}));
+  using borrowing =
+      decltype(omp::enumerate(std::declval<std::vector<int> &>()));
+
+  ASSERT_FALSE(is_splittable<owning>::value);
+  ASSERT_TRUE(is_splittable<owning &>::value);
+  ASSERT_TRUE(is_splittable<const owning &>::value);
+  ASSERT_TRUE(is_splittable<borrowing>::value);
+
+  std::vector<int> values(7);
+
+  for (auto part : omp::enumerate(values).split(2))
+    for (auto [idx, value] : part)
+      value = static_cast<int>(idx);
+
+  for (std::size_t i = 0; i < values.size(); ++i)
+    ASSERT_EQ(values[i], static_cast<int>(i));
+
+  int array[] = {0, 0, 0, 0, 0};
+
+  for (auto part :
+       omp::enumerate(std::begin(array), std::end(array), 10).chunks(2))
+    for (auto [idx, value] : part)
+      value = static_cast<int>(idx);
+
+  ASSERT_TRUE(std::equal(std::cbegin(array), std::cend(array),
+                         std::cbegin(omp::range(10, 15))));
+}
@@ -0,0 +1,140 @@
+#include "omp/utils/linspace.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+TEST(omp_linspace, simple_case) {
+  const std::vector<double> expecting = {0.0, 0.25, 0.5, 0.75, 1.0};
+
+  std::vector<double> result;
+
+  for (auto v : omp::linspace(0.0, 1.0, 5))
+    result.emplace_back(v);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_linspace, endpoints) {
+  auto r = omp::linspace(-2.0, 6.0, 9);
+
+  ASSERT_EQ(r.size(), 9u);
+  ASSERT_EQ(r[0], -2.0);
+  ASSERT_EQ(r[8], 6.0);
+  ASSERT_EQ(*std::prev(std::cend(r)), 6.0);
+}
+
+TEST(omp_linspace, without_endpoint) {
+  const std::vector<double> expecting = {2.0, 2.5, 3.0, 3.5};
+
+  auto r = omp::linspace(2, 4, 4, false);
+
+  ASSERT_EQ(std::vector<double>(std::cbegin(r), std::cend(r)), expecting);
+}
+
+TEST(omp_linspace, small_counts) {
+  auto r0 = omp::linspace(1.0, 2.0, 0);
+  auto r1 = omp::linspace(1.0, 2.0, 1);
+
+  ASSERT_TRUE(r0.empty());
+  ASSERT_EQ(std::distance(std::cbegin(r0), std::cend(r0)), 0);
+
+  ASSERT_EQ(r1.size(), 1u);
+  ASSERT_EQ(r1[0], 1.0);
+}
+
+TEST(omp_linspace, value_types) {
+  auto r_is_double = std::is_same_v<
+      double, typename decltype(omp::linspace(0, 1, 3))::value_type>;
+  auto r_is_float = std::is_same_v<
+      float, typename decltype(omp::linspace(0.0f, 1, 3))::value_type>;
+
+  ASSERT_TRUE(r_is_double && r_is_float);
+}
+
+TEST(omp_linspace, matches_index_formula) {
+  auto r = omp::linspace(-3.0, 5.0, 1001);
+  auto it = std::cbegin(r);
+
+  const double step = 8.0 / 1000;
+
+  for (std::size_t i = 0; i < r.size(); ++i) {
+    ASSERT_EQ(r[i], -3.0 + static_cast<double>(i) * step);
+    ASSERT_EQ(it[i], r[i]);
+  }
+
+  ASSERT_EQ(std::cend(r) - it, 1001);
+}
+
+TEST(omp_linspace, iterators_outlive_view) {
+  auto it = std::cbegin(omp::linspace(0.0, 1.0, 5));
+
+  ASSERT_EQ(it[1], 0.25);
+  ASSERT_EQ(*(it + 4), 1.0);
+}
+
+TEST(omp_arange, simple_case) {
+  const std::vector<double> expecting = {0.0, 0.5, 1.0, 1.5};
+
+  auto r = omp::arange(0.0, 2.0, 0.5);
+
+  ASSERT_EQ(std::vector<double>(std::cbegin(r), std::cend(r)), expecting);
+}
+
+TEST(omp_arange, rounding_never_reaches_stop) {
+  auto r1 = omp::arange(1.0, 1.3, 0.1);
+
+  ASSERT_EQ(r1.size(), 3u);
+  ASSERT_LT(r1[2], 1.3);
+
+  auto r2 = omp::arange(0.0, 1.0, 0.1);
+
+  ASSERT_EQ(r2.size(), 10u);
+  ASSERT_LT(r2[9], 1.0);
+}
+
+TEST(omp_arange, negative_step) {
+  const std::vector<double> expecting = {1.0, 0.75, 0.5, 0.25};
+
+  auto r = omp::arange(1.0, 0.0, -0.25);
+
+  ASSERT_EQ(std::vector<double>(std::cbegin(r), std::cend(r)), expecting);
+}
+
+TEST(omp_arange, empty) {
+  ASSERT_TRUE(omp::arange(1.0, 0.0, 0.5).empty());
+  ASSERT_TRUE(omp::arange(0.0, 1.0, -0.5).empty());
+  ASSERT_TRUE(omp::arange(0.0).empty());
+}
+
+TEST(omp_arange, default_arguments) {
+  const std::vector<double> expecting = {0.0, 1.0, 2.0};
+
+  auto r = omp::arange(3);
+
+  ASSERT_EQ(std::vector<double>(std::cbegin(r), std::cend(r)), expecting);
+  ASSERT_EQ(omp::arange(0.5, 3).size(), 3u);
+}
+
+TEST(omp_arange, invalid_arguments) {
+  ASSERT_THROW(omp::arange(0.0, 1.0, 0.0), std::logic_error);
+  ASSERT_THROW(omp::arange(0.0, 1e20, 1.0), std::logic_error);
+  ASSERT_THROW(omp::arange(0.0, std::numeric_limits<double>::infinity(), 1.0),
+               std::logic_error);
+}
+
+TEST(omp_arange, random_access) {
+  auto r = omp::arange(-1.0, 1.0, 0.125);
+
+  ASSERT_EQ(r.size(), 16u);
+
+  auto found = std::lower_bound(std::cbegin(r), std::cend(r), 0.3);
+
+  ASSERT_EQ(*found, 0.375);
+  ASSERT_EQ(found - std::cbegin(r), 11);
+}
@@ -0,0 +1,171 @@
+#include "omp/utils/ndrange.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+TEST(omp_ndrange, row_major_order) {
+  std::vector<std::array<int, 2>> expecting;
+
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      expecting.push_back({i, j});
+
+  std::vector<std::array<int, 2>> result;
+
+  for (auto idx : omp::ndrange({3, 4}))
+    result.emplace_back(idx);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_ndrange, structured_bindings) {
+  std::vector<std::array<int, 3>> expecting;
+
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k)
+        expecting.push_back({i, j, k});
+
+  std::vector<std::array<int, 3>> result;
+
+  for (auto [i, j, k] : omp::ndrange({2, 3, 4}))
+    result.push_back({i, j, k});
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_ndrange, box) {
+  std::vector<std::array<int, 2>> expecting;
+
+  for (int i = -1; i < 2; ++i)
+    for (int j = 5; j < 7; ++j)
+      expecting.push_back({i, j});
+
+  auto r = omp::ndrange({-1, 5}, {2, 7});
+
+  const std::vector<std::array<int, 2>> result(std::cbegin(r), std::cend(r));
+
+  ASSERT_EQ(r.size(), expecting.size());
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_ndrange, empty) {
+  auto r1 = omp::ndrange({3, 0, 4});
+  auto r2 = omp::ndrange({5, 5}, {2, 7});
+
+  ASSERT_TRUE(r1.empty());
+  ASSERT_EQ(std::distance(std::cbegin(r1), std::cend(r1)), 0);
+
+  ASSERT_TRUE(r2.empty());
+  ASSERT_TRUE(r2.tiled({2, 2}).empty());
+}
+
+TEST(omp_ndrange, random_access) {
+  auto r = omp::ndrange({3, 4, 5});
+  auto first = std::cbegin(r);
+
+  ASSERT_EQ(std::cend(r) - first, 60);
+
+  ASSERT_EQ(r[0], (std::array<int, 3>{0, 0, 0}));
+  ASSERT_EQ(r[27], (std::array<int, 3>{1, 1, 2}));
+  ASSERT_EQ(first[59], (std::array<int, 3>{2, 3, 4}));
+
+  auto it = first + 27;
+
+  ASSERT_EQ(*it, r[27]);
+  ASSERT_EQ(*++it, r[28]);
+  ASSERT_EQ(*--it, r[27]);
+  ASSERT_EQ(*std::prev(std::cend(r)), r[59]);
+
+  for (std::size_t i = 0; i < r.size(); ++i, ++first)
+    ASSERT_EQ(*first, r[i]);
+}
+
+TEST(omp_ndrange, linear_split) {
+  auto r = omp::ndrange({7, 5});
+
+  const std::vector<std::array<int, 2>> expecting(std::cbegin(r), std::cend(r));
+
+  std::vector<std::array<int, 2>> result;
+
+  for (auto part : r.linear().split(3))
+    for (auto idx : part)
+      result.emplace_back(r[idx]);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_ndrange, iterators_outlive_view) {
+  auto it = std::cbegin(omp::ndrange({3, 4}));
+
+  ASSERT_EQ(*++it, (std::array<int, 2>{0, 1}));
+  ASSERT_EQ(it[4], (std::array<int, 2>{1, 1}));
+
+  auto tile = std::cbegin(omp::ndrange({3, 4}).tiled({2, 2}));
+
+  ASSERT_EQ(tile[3].first(), (std::array<int, 2>{2, 2}));
+  ASSERT_EQ(tile[3].size(), 2u);
+}
+
+TEST(omp_ndrange, tiled_covers_once) {
+  auto r = omp::ndrange({-2, 1}, {9, 8});
+  auto tiles = r.tiled({4, 3});
+
+  const std::set<std::array<int, 2>> expecting(std::cbegin(r), std::cend(r));
+
+  ASSERT_EQ(tiles.size(), 9u);
+  ASSERT_EQ(tiles.counts(), (std::array<std::size_t, 2>{3, 3}));
+
+  std::set<std::array<int, 2>> visited;
+  std::size_t count = 0;
+
+  for (auto tile : tiles)
+    for (auto idx : tile) {
+      visited.insert(idx);
+      ++count;
+    }
+
+  ASSERT_EQ(count, r.size());
+  ASSERT_EQ(visited, expecting);
+}
+
+TEST(omp_ndrange, tiled_order) {
+  const std::vector<std::array<int, 2>> expecting = {
+      {0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {1, 2},
+      {2, 0}, {2, 1}, {2, 2},
+  };
+
+  std::vector<std::array<int, 2>> result;
+
+  for (auto tile : omp::ndrange({3, 3}).tiled({2, 2}))
+    for (auto idx : tile)
+      result.emplace_back(idx);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_ndrange, tiled_edges) {
+  auto tiles = omp::ndrange({5, 7}).tiled({2, 3});
+
+  ASSERT_EQ(tiles.size(), 9u);
+
+  auto last = tiles[tiles.size() - 1];
+
+  ASSERT_EQ(last.first(), (std::array<int, 2>{4, 6}));
+  ASSERT_EQ(last.extents(), (std::array<std::size_t, 2>{1, 1}));
+
+  auto middle = *(std::cbegin(tiles) + 4);
+
+  ASSERT_EQ(middle.first(), (std::array<int, 2>{2, 3}));
+  ASSERT_EQ(middle.extents(), (std::array<std::size_t, 2>{2, 3}));
+}
+
+TEST(omp_ndrange, tiled_zero) {
+  ASSERT_THROW(omp::ndrange({4, 4}).tiled({0, 2}), std::logic_error);
+}
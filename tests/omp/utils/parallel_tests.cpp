@@ -0,0 +1,334 @@
+#include "omp/utils/enumerate.h"
+#include "omp/utils/linspace.h"
+#include "omp/utils/ndrange.h"
+#include "omp/utils/parallel.h"
+#include "omp/utils/range.h"
+#include "omp/utils/zip.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+TEST(omp_parallel_for, visits_every_element_once) {
+  omp::thread_pool pool(4);
+
+  std::vector<std::atomic<int>> visits(10007);
+
+  omp::parallel_for(pool, omp::range(visits.size()),
+                    [&](std::size_t i) { ++visits[i]; });
+
+  for (const auto &count : visits)
+    ASSERT_EQ(count.load(), 1);
+}
+
+TEST(omp_parallel_for, step_and_grain) {
+  omp::thread_pool pool(3);
+
+  std::vector<std::atomic<int>> visits(1000);
+
+  omp::parallel_for(
+      pool, omp::range(999, -1, -3), [&](int i) { ++visits[i]; }, 7);
+
+  for (int i = 0; i < 1000; ++i)
+    ASSERT_EQ(visits[i].load(), (999 - i) % 3 == 0 ? 1 : 0);
+}
+
+TEST(omp_parallel_for, empty) {
+  std::atomic<int> calls{0};
+
+  omp::parallel_for(omp::range(0), [&](int) { ++calls; });
+
+  ASSERT_EQ(calls.load(), 0);
+}
+
+TEST(omp_parallel_for, adaptors) {
+  omp::thread_pool pool(4);
+
+  std::vector<std::atomic<int>> cells(20 * 30);
+
+  omp::parallel_for(pool, omp::ndrange({20, 30}), [&](auto idx) {
+    auto [i, j] = idx;
+    ++cells[i * 30 + j];
+  });
+
+  for (const auto &count : cells)
+    ASSERT_EQ(count.load(), 1);
+
+  std::vector<int> values(5000, 1);
+
+  omp::parallel_for(pool, values, [](int &value) { value *= 3; });
+
+  ASSERT_EQ(std::accumulate(values.begin(), values.end(), 0), 15000);
+
+  std::vector<std::ptrdiff_t> indices(5000);
+
+  omp::parallel_for(pool, omp::enumerate(indices, 7),
+                    [](auto element) { element.second = element.first; });
+
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    ASSERT_EQ(indices[i], static_cast<std::ptrdiff_t>(i) + 7);
+
+  omp::parallel_for(pool, omp::enumerate(indices).split(pool.size()),
+                    [](auto part) {
+                      for (auto [idx, value] : part)
+                        value = -idx;
+                    });
+
+  for (std::size_t i = 0; i < indices.size(); ++i)
+    ASSERT_EQ(indices[i], -static_cast<std::ptrdiff_t>(i));
+}
+
+TEST(omp_parallel_for, nested) {
+  omp::thread_pool pool(4);
+
+  std::vector<std::atomic<int>> visits(64 * 64);
+
+  omp::parallel_for(pool, omp::range(64), [&](int i) {
+    omp::parallel_for(pool, omp::range(64),
+                      [&](int j) { ++visits[i * 64 + j]; });
+  });
+
+  for (const auto &count : visits)
+    ASSERT_EQ(count.load(), 1);
+}
+
+TEST(omp_parallel_for, exception) {
+  omp::thread_pool pool(4);
+
+  ASSERT_THROW(omp::parallel_for(
+                   pool, omp::range(100000),
+                   [](int i) {
+                     if (i == 77777)
+                       throw std::runtime_error("failure");
+                   },
+                   16),
+               std::runtime_error);
+
+  std::atomic<int> calls{0};
+
+  omp::parallel_for(pool, omp::range(100), [&](int) { ++calls; });
+
+  ASSERT_EQ(calls.load(), 100);
+}
+
+TEST(omp_parallel_reduce, sum) {
+  omp::thread_pool pool(4);
+
+  auto result = omp::parallel_reduce(pool, omp::range(std::int64_t{1000001}),
+                                     std::int64_t{5}, std::plus<>());
+
+  ASSERT_EQ(result, std::int64_t{1000000} * 1000001 / 2 + 5);
+}
+
+TEST(omp_parallel_reduce, empty) {
+  ASSERT_EQ(omp::parallel_reduce(omp::range(0), 42, std::plus<>()), 42);
+}
+
+TEST(omp_parallel_reduce, keeps_order) {
+  omp::thread_pool pool(4);
+
+  std::vector<std::string> digits;
+  std::string expecting;
+
+  for (auto i : omp::range(1000)) {
+    digits.emplace_back(1, static_cast<char>('0' + i % 10));
+    expecting += digits.back();
+  }
+
+  auto result =
+      omp::parallel_reduce(pool, digits, std::string(), std::plus<>(), 3);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_parallel_reduce, linspace) {
+  auto result =
+      omp::parallel_reduce(omp::linspace(0.0, 1.0, 1025), 0.0, std::plus<>());
+
+  ASSERT_DOUBLE_EQ(result, 512.5);
+}
+
+TEST(omp_parallel_for, zip) {
+  omp::thread_pool pool(4);
+
+  std::vector<int> lhs(5000), rhs(5000, 2), out(6000);
+  std::iota(lhs.begin(), lhs.end(), 0);
+
+  omp::parallel_for(pool, omp::zip(out, lhs, rhs), [](auto element) {
+    auto [result, first, second] = element;
+    result = first * second;
+  });
+
+  for (std::size_t i = 0; i < out.size(); ++i)
+    ASSERT_EQ(out[i], i < lhs.size() ? 2 * static_cast<int>(i) : 0);
+}
+
+TEST(omp_parallel_transform_reduce, inner_product) {
+  omp::thread_pool pool(4);
+
+  std::vector<std::int64_t> lhs(10001), rhs(10001, 3);
+  std::iota(lhs.begin(), lhs.end(), 0);
+
+  auto result = omp::parallel_transform_reduce(
+      pool, omp::zip(lhs, rhs), std::int64_t{1}, std::plus<>(),
+      [](auto element) {
+        auto [first, second] = element;
+        return first * second;
+      });
+
+  ASSERT_EQ(result, std::int64_t{10000} * 10001 / 2 * 3 + 1);
+}
+
+TEST(omp_parallel_transform_reduce, weighted_sum) {
+  std::vector<int> weights(1000, 2);
+
+  auto result = omp::parallel_transform_reduce(
+      omp::enumerate(weights), std::int64_t{0}, std::plus<>(),
+      [](auto element) -> std::int64_t {
+        auto [idx, weight] = element;
+        return idx * weight;
+      });
+
+  ASSERT_EQ(result, std::int64_t{999} * 1000);
+}
+
+TEST(omp_parallel_transform_reduce, multi_column_aggregate) {
+  omp::thread_pool pool(3);
+
+  std::vector<double> prices = {1.5, 2.0, 4.0, 0.5};
+  std::vector<int> amounts = {2, 1, 3, 10};
+
+  using aggregate = std::tuple<double, int, double>;
+
+  auto [revenue, items, highest] = omp::parallel_transform_reduce(
+      pool, omp::zip(prices, amounts), aggregate{0.0, 0, 0.0},
+      [](const aggregate &lhs, const aggregate &rhs) {
+        return aggregate{std::get<0>(lhs) + std::get<0>(rhs),
+                         std::get<1>(lhs) + std::get<1>(rhs),
+                         std::max(std::get<2>(lhs), std::get<2>(rhs))};
+      },
+      [](auto element) {
+        auto [price, amount] = element;
+        return aggregate{price * amount, amount, price};
+      },
+      1);
+
+  ASSERT_DOUBLE_EQ(revenue, 22.0);
+  ASSERT_EQ(items, 16);
+  ASSERT_DOUBLE_EQ(highest, 4.0);
+}
+
+TEST(omp_parallel_transform_reduce, keeps_order) {
+  omp::thread_pool pool(4);
+
+  std::vector<int> digits(1000);
+  std::iota(digits.begin(), digits.end(), 0);
+
+  std::string expecting;
+
+  for (auto digit : digits)
+    expecting += static_cast<char>('0' + digit % 10);
+
+  auto result = omp::parallel_transform_reduce(
+      pool, digits, std::string(), std::plus<>(),
+      [](int digit) { return std::string(1, char('0' + digit % 10)); }, 3);
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_parallel_transform_reduce, empty) {
+  std::vector<int> lhs, rhs(10);
+
+  ASSERT_EQ(omp::parallel_transform_reduce(omp::zip(lhs, rhs), 7,
+                                           std::plus<>(),
+                                           [](auto) { return 1; }),
+            7);
+}
+
+TEST(omp_parallel_tuple_map, same_result_as_tuple_map) {
+  omp::thread_pool pool(3);
+
+  const auto twice = [](const auto &value) { return value + value; };
+  const auto jobs = std::make_tuple(1, 2.5, std::string("ab"));
+
+  auto result = omp::parallel_tuple_map(pool, twice, jobs);
+
+  static_assert(std::is_same_v<decltype(result),
+                               decltype(omp::tuple_map(twice, jobs))>);
+
+  ASSERT_EQ(result, std::make_tuple(2, 5.0, std::string("abab")));
+
+  auto sums = omp::parallel_tuple_map(std::plus<>(), std::array{1, 2},
+                                      std::make_pair(3, 4));
+
+  ASSERT_EQ(sums, std::make_tuple(4, 6));
+}
+
+TEST(omp_parallel_tuple_map, references) {
+  auto values = std::make_tuple(1, 2);
+
+  auto refs = omp::parallel_tuple_map(
+      [](int &value) -> int & { return value; }, values);
+
+  std::get<1>(refs) = 5;
+
+  ASSERT_EQ(std::get<1>(values), 5);
+}
+
+TEST(omp_parallel_tuple_map, runs_concurrently) {
+  omp::thread_pool pool(3);
+
+  std::atomic<int> started{0};
+
+  // Every job waits for all the others to start, which never happens when
+  // they run one after another.
+  const auto job = [&started](int value) {
+    ++started;
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (started.load() < 3 && std::chrono::steady_clock::now() < deadline)
+      std::this_thread::yield();
+
+    return started.load() == 3 ? value : -1;
+  };
+
+  auto result = omp::parallel_tuple_map(pool, job, std::make_tuple(1, 2, 3));
+
+  ASSERT_EQ(result, std::make_tuple(1, 2, 3));
+}
+
+TEST(omp_parallel_tuple_map, exception) {
+  omp::thread_pool pool(2);
+
+  std::atomic<int> calls{0};
+
+  const auto job = [&calls](int value) {
+    ++calls;
+
+    if (value > 1)
+      throw std::runtime_error(std::to_string(value));
+
+    return value;
+  };
+
+  try {
+    omp::parallel_tuple_map(pool, job, std::make_tuple(1, 2, 3));
+    FAIL();
+  } catch (const std::runtime_error &error) {
+    ASSERT_EQ(std::string(error.what()), "2");
+  }
+
+  ASSERT_EQ(calls.load(), 3);
+}
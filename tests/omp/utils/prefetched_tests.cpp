@@ -0,0 +1,118 @@
+#include "omp/utils/enumerate.h"
+#include "omp/utils/prefetched.h"
+#include "omp/utils/range.h"
+#include "omp/utils/zip.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+TEST(omp_prefetched, same_elements) {
+  std::vector<int> values(100);
+  std::iota(values.begin(), values.end(), 0);
+
+  for (std::size_t distance : {0, 1, 16, 100, 1000}) {
+    std::vector<int> visited;
+
+    for (auto value : omp::prefetched(values, distance))
+      visited.push_back(value);
+
+    ASSERT_EQ(visited, values);
+  }
+}
+
+TEST(omp_prefetched, forward_range) {
+  std::list<int> values = {1, 2, 3, 4, 5};
+
+  int sum = 0;
+
+  for (auto &value : omp::prefetched(values, 2)) {
+    value *= 2;
+    sum += value;
+  }
+
+  ASSERT_EQ(sum, 30);
+  ASSERT_EQ(values.back(), 10);
+}
+
+TEST(omp_prefetched, zip_and_enumerate) {
+  std::vector<int> lhs = {1, 2, 3, 4};
+  std::vector<int> rhs = {5, 6, 7, 8, 9};
+  std::vector<int> out(4);
+
+  for (auto [result, first, second] :
+       omp::prefetched(omp::zip(out, lhs, rhs), 2))
+    result = first * second;
+
+  ASSERT_EQ(out, std::vector<int>({5, 12, 21, 32}));
+
+  for (auto [idx, value] : omp::prefetched(omp::enumerate(out), 3))
+    value = static_cast<int>(idx);
+
+  ASSERT_EQ(out, std::vector<int>({0, 1, 2, 3}));
+
+  int sum = 0;
+
+  for (auto value : omp::prefetched(omp::range(10), 4))
+    sum += value;
+
+  ASSERT_EQ(sum, 45);
+}
+
+TEST(omp_prefetched, target_sees_elements_ahead) {
+  std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<int> ahead;
+
+  auto view = omp::prefetched(values, 3, [&](int value) {
+    ahead.push_back(value);
+  });
+
+  std::vector<int> visited;
+
+  for (auto value : view) {
+    // Element i + 3 is announced when moving past element i.
+    if (!ahead.empty()) {
+      ASSERT_EQ(ahead.back(), std::min(value + 2, 7));
+    }
+
+    visited.push_back(value);
+  }
+
+  ASSERT_EQ(visited, values);
+  ASSERT_EQ(ahead, std::vector<int>({3, 4, 5, 6, 7}));
+}
+
+TEST(omp_prefetched, gather) {
+  std::vector<double> data = {0.5, 1.5, 2.5, 3.5};
+  std::vector<std::size_t> indices = {3, 0, 2, 2, 1};
+  std::vector<double> out(indices.size());
+
+  for (auto [idx, result] : omp::prefetched(
+           omp::zip(indices, out), 2,
+           [&](auto ahead) { return &data[std::get<0>(ahead)]; }))
+    result = data[idx];
+
+  ASSERT_EQ(out, std::vector<double>({3.5, 0.5, 2.5, 2.5, 1.5}));
+}
+
+TEST(omp_prefetched, iterators_outlive_view) {
+  std::vector<int> values = {0, 1, 2, 3, 4, 5};
+  std::vector<int> ahead;
+
+  auto target = [&ahead](int value) { ahead.push_back(value); };
+
+  auto it = std::cbegin(omp::prefetched(values, 2, target));
+  auto last = it;
+  last = std::cend(omp::prefetched(values, 2, target));
+
+  ++it;
+  ++it;
+
+  ASSERT_EQ(*it, 2);
+  ASSERT_EQ(ahead, std::vector<int>({2, 3}));
+  ASSERT_EQ(std::distance(it, last), 4);
+}
@@ -0,0 +1,18 @@
+#include "omp/utils/range_simd.h"
+
+#include "gtest/gtest.h"
+
+#ifdef __cpp_lib_experimental_parallel_simd
+TEST(omp_range_simd, batch_lanes) {
+  auto lanes = omp::simd(omp::range(16).batches<4>()[1]);
+
+  ASSERT_EQ(std::experimental::reduce(lanes), 4 + 5 + 6 + 7);
+}
+
+TEST(omp_range_simd, negative_step) {
+  auto lanes = omp::simd(omp::range(10, 0, -1).batches<8>()[0]);
+
+  ASSERT_EQ(lanes[0], 10);
+  ASSERT_EQ(lanes[7], 3);
+}
+#endif
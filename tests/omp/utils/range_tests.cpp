@@ -2,6 +2,13 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
 TEST(omp_range, zero_one_overload) {
   auto r = omp::range(0);
 
@@ -295,3 +302,274 @@ TEST(omp_range, overload_three_different_value_types) {
 
   ASSERT_TRUE(r_is_c_int);
 }
+
+TEST(omp_range, random_access_iterator_category) {
+  using iterator = decltype(omp::range(10))::iterator;
+
+  auto is_random_access =
+      std::is_same_v<std::random_access_iterator_tag,
+                     std::iterator_traits<iterator>::iterator_category>;
+
+  ASSERT_TRUE(is_random_access);
+}
+
+TEST(omp_range, distance_and_size) {
+  auto r1 = omp::range(1, 12, 4);
+  auto r2 = omp::range(91, -49, -21);
+  auto r3 = omp::range(10, 5);
+
+  ASSERT_EQ(std::distance(std::cbegin(r1), std::cend(r1)), 3);
+  ASSERT_EQ(r1.size(), 3u);
+
+  ASSERT_EQ(std::distance(std::cbegin(r2), std::cend(r2)), 7);
+  ASSERT_EQ(r2.size(), 7u);
+
+  ASSERT_EQ(std::distance(std::cbegin(r3), std::cend(r3)), 0);
+  ASSERT_TRUE(r3.empty());
+}
+
+TEST(omp_range, jump_and_index) {
+  const std::vector<std::int64_t> expecting = {91, 70, 49, 28, 7, -14, -35};
+
+  auto r = omp::range(91, -49, -21);
+  auto it = std::cbegin(r);
+
+  for (std::size_t i = 0; i < std::size(expecting); ++i) {
+    ASSERT_EQ(it[i], expecting[i]);
+    ASSERT_EQ(r[i], expecting[i]);
+    ASSERT_EQ(*(it + i), expecting[i]);
+  }
+
+  it += 4;
+  ASSERT_EQ(*it, 7);
+
+  it -= 3;
+  ASSERT_EQ(*it, 70);
+
+  ASSERT_EQ(*std::prev(std::cend(r)), -35);
+  ASSERT_EQ(std::cend(r) - it, 6);
+}
+
+TEST(omp_range, comparison) {
+  auto r = omp::range(0, 12, 2);
+
+  auto first = std::cbegin(r), last = std::cend(r);
+
+  ASSERT_TRUE(first < last);
+  ASSERT_TRUE(last > first);
+  ASSERT_TRUE(first <= first);
+  ASSERT_TRUE(last >= last);
+  ASSERT_FALSE(last < first);
+  ASSERT_EQ(first + 6, last);
+}
+
+TEST(omp_range, std_algorithms) {
+  auto r = omp::range(-53, 89, 13);
+
+  auto found = std::lower_bound(std::cbegin(r), std::cend(r), 30);
+
+  ASSERT_EQ(*found, 38);
+  ASSERT_EQ(found - std::cbegin(r), 7);
+
+  auto reversed = std::vector<int>(std::make_reverse_iterator(std::cend(r)),
+                                   std::make_reverse_iterator(std::cbegin(r)));
+
+  ASSERT_EQ(reversed.front(), 77);
+  ASSERT_EQ(reversed.back(), -53);
+}
+
+TEST(omp_range, limits) {
+  auto r1 = omp::range(INT_MIN, INT_MAX, 1 << 30);
+
+  ASSERT_EQ(r1.size(), 4u);
+  ASSERT_EQ(*std::prev(std::cend(r1)), (1 << 30));
+
+  auto r2 = omp::range(static_cast<signed char>(127),
+                       static_cast<signed char>(-128),
+                       static_cast<signed char>(-51));
+
+  ASSERT_EQ(r2.size(), 5u);
+  ASSERT_EQ(r2[4], -77);
+
+  auto r3 = omp::range(std::size_t{0}, SIZE_MAX, SIZE_MAX / 2);
+
+  ASSERT_EQ(r3.size(), 3u);
+}
+
+TEST(omp_range, too_many_elements) {
+  ASSERT_THROW(omp::range<std::uint64_t>(0, UINT64_MAX), std::logic_error);
+  ASSERT_THROW(omp::range<std::int64_t>(INT64_MIN, INT64_MAX),
+               std::logic_error);
+  ASSERT_THROW(omp::range<std::int64_t>(INT64_MAX, INT64_MIN, -1),
+               std::logic_error);
+
+  ASSERT_THROW(omp::range<std::uint64_t>(0, std::uint64_t{INT64_MAX} + 1),
+               std::logic_error);
+
+  auto r = omp::range<std::uint64_t>(0, INT64_MAX);
+
+  ASSERT_EQ(std::cend(r) - std::cbegin(r), INT64_MAX);
+  ASSERT_EQ(*std::prev(std::cend(r)), std::uint64_t{INT64_MAX} - 1);
+}
+
+TEST(omp_range, iterate_up_to_limits) {
+  const auto collect = [](auto r) {
+    return std::vector<std::int64_t>(std::cbegin(r), std::cend(r));
+  };
+
+  ASSERT_EQ(collect(omp::range(INT_MIN, INT_MAX, 1 << 30)),
+            (std::vector<std::int64_t>{INT_MIN, INT_MIN / 2, 0, 1 << 30}));
+
+  ASSERT_EQ(collect(omp::range(INT_MAX - 20, INT_MAX, 7)),
+            (std::vector<std::int64_t>{INT_MAX - 20, INT_MAX - 13,
+                                       INT_MAX - 6}));
+
+  ASSERT_EQ(collect(omp::range(INT_MIN + 20, INT_MIN, -7)),
+            (std::vector<std::int64_t>{INT_MIN + 20, INT_MIN + 13,
+                                       INT_MIN + 6}));
+
+  ASSERT_EQ(collect(omp::range<std::int8_t>(0, 127, 2)).back(), 126);
+  ASSERT_EQ(collect(omp::range<std::int8_t>(100, 127, 20)),
+            (std::vector<std::int64_t>{100, 120}));
+
+  auto evens = omp::range(0, INT_MAX, 2);
+
+  ASSERT_EQ(evens.size(), std::size_t{INT_MAX / 2 + 1});
+  ASSERT_EQ(std::vector<int>(std::cend(evens) - 2, std::cend(evens)),
+            (std::vector<int>{INT_MAX - 3, INT_MAX - 1}));
+
+  auto sevens = omp::range(0, INT_MAX, 7);
+  auto last = std::prev(std::cend(sevens));
+
+  ASSERT_EQ(*last, INT_MAX - 1);
+  ASSERT_EQ(++last, std::cend(sevens));
+}
+
+TEST(omp_range, slice) {
+  const std::vector<std::int64_t> expecting = {49, 28, 7};
+
+  auto r = omp::range(91, -49, -21).slice(2, 5);
+
+  ASSERT_EQ(std::vector<std::int64_t>(std::cbegin(r), std::cend(r)), expecting);
+  ASSERT_EQ(r.step(), -21);
+}
+
+TEST(omp_range, split_balanced) {
+  auto r = omp::range(-53, 89, 13);
+  auto parts = r.split(4);
+
+  ASSERT_EQ(parts.size(), 4u);
+  ASSERT_EQ(std::distance(std::cbegin(parts), std::cend(parts)), 4);
+
+  const std::vector<std::size_t> sizes = {3, 3, 3, 2};
+
+  std::vector<std::int64_t> joined;
+
+  for (std::size_t i = 0; i < parts.size(); ++i) {
+    ASSERT_EQ(parts[i].size(), sizes[i]);
+    ASSERT_EQ(parts[i].step(), 13);
+
+    for (auto v : parts[i])
+      joined.emplace_back(v);
+  }
+
+  ASSERT_EQ(joined, std::vector<std::int64_t>(std::cbegin(r), std::cend(r)));
+}
+
+TEST(omp_range, partition_iterators_outlive_view) {
+  auto part = std::cbegin(omp::range(10).split(3));
+
+  ASSERT_EQ(part[1].size(), 3u);
+  ASSERT_EQ(*std::cbegin(part[2]), 7);
+
+  auto batch = std::cbegin(omp::range(16).batches<4>());
+
+  ASSERT_EQ(batch[2][1], 9);
+}
+
+TEST(omp_range, split_more_parts_than_elements) {
+  auto parts = omp::range(10, 0, -4).split(5);
+
+  const std::vector<std::size_t> sizes = {1, 1, 1, 0, 0};
+
+  std::vector<std::size_t> result;
+
+  for (auto part : parts)
+    result.emplace_back(part.size());
+
+  ASSERT_EQ(result, sizes);
+  ASSERT_EQ(*std::cbegin(parts[2]), 2);
+}
+
+TEST(omp_range, split_zero_parts) {
+  ASSERT_THROW(omp::range(10).split(0), std::logic_error);
+}
+
+TEST(omp_range, chunks_by_grain) {
+  auto r = omp::range(0, 100, 3);
+  auto parts = r.chunks(8);
+
+  ASSERT_EQ(r.size(), 34u);
+  ASSERT_EQ(parts.size(), 5u);
+
+  auto last = std::cend(parts) - 1;
+
+  ASSERT_EQ((*last).size(), 2u);
+  ASSERT_EQ(*std::cbegin(*last), 96);
+  ASSERT_EQ(std::cbegin(parts)[1][0], 24);
+
+  ASSERT_TRUE(omp::range(0).chunks(8).empty());
+  ASSERT_THROW(r.chunks(0), std::logic_error);
+}
+
+TEST(omp_range, batches_with_tail) {
+  auto r = omp::range(3, 40, 3);
+  auto batches = r.batches<4>();
+
+  ASSERT_EQ(r.size(), 13u);
+  ASSERT_EQ(batches.size(), 3u);
+  ASSERT_EQ(std::distance(std::cbegin(batches), std::cend(batches)), 3);
+
+  std::vector<std::int64_t> joined;
+
+  for (const auto &batch : batches)
+    joined.insert(std::end(joined), std::cbegin(batch), std::cend(batch));
+
+  auto tail = batches.tail();
+
+  ASSERT_EQ(tail.size(), 1u);
+  ASSERT_EQ(*std::cbegin(tail), 39);
+
+  for (auto v : tail)
+    joined.emplace_back(v);
+
+  ASSERT_EQ(joined, std::vector<std::int64_t>(std::cbegin(r), std::cend(r)));
+}
+
+TEST(omp_range, batches_negative_step) {
+  auto batches = omp::range(10, 0, -1).batches<8>();
+
+  ASSERT_EQ(batches.size(), 1u);
+
+  const std::array<int, 8> expecting = {10, 9, 8, 7, 6, 5, 4, 3};
+  const auto batch = batches[0];
+
+  ASSERT_TRUE(std::equal(std::cbegin(batch), std::cend(batch),
+                         std::cbegin(expecting)));
+  ASSERT_EQ(batches.tail().size(), 2u);
+  ASSERT_EQ(*std::cbegin(batches.tail()), 2);
+}
+
+TEST(omp_range, batches_alignment) {
+  using batch = decltype(omp::range(std::int64_t{16}).batches<8>()[0]);
+
+  ASSERT_EQ(alignof(batch), 64u);
+  ASSERT_EQ(alignof(decltype(omp::range(16).batches<8>()[0])), 32u);
+  ASSERT_EQ(alignof(decltype(omp::range(16).batches<3>()[0])), 4u);
+
+  auto empty = omp::range(5).batches<8>();
+
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(std::cbegin(empty), std::cend(empty));
+  ASSERT_EQ(empty.tail().size(), 5u);
+}
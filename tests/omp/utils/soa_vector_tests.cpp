@@ -0,0 +1,236 @@
+#include "omp/utils/soa_vector.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(omp_soa_vector, empty) {
+  omp::soa_vector<int, double> records;
+
+  ASSERT_TRUE(records.empty());
+  ASSERT_EQ(records.size(), 0u);
+  ASSERT_TRUE(std::cbegin(records) == std::cend(records));
+  ASSERT_TRUE(records.column<1>().empty());
+}
+
+TEST(omp_soa_vector, push_back_and_access) {
+  omp::soa_vector<int, std::string> records;
+
+  records.push_back(1, "one");
+  records.emplace_back(2, std::string(3, 'x'));
+
+  std::string three = "three";
+  records.push_back(3, three);
+
+  ASSERT_EQ(records.size(), 3u);
+  ASSERT_EQ(std::get<0>(records[1]), 2);
+  ASSERT_EQ(std::get<1>(records[1]), "xxx");
+  ASSERT_EQ(std::get<1>(records.at(2)), "three");
+  ASSERT_THROW(records.at(3), std::out_of_range);
+
+  auto [number, name] = records[0];
+
+  number = 10;
+  name += "!";
+
+  ASSERT_EQ(records.column<0>()[0], 10);
+  ASSERT_EQ(records.column<1>()[0], "one!");
+
+  records.pop_back();
+
+  ASSERT_EQ(records.size(), 2u);
+  ASSERT_EQ(records.column<1>().size(), 2u);
+}
+
+TEST(omp_soa_vector, columns_are_aligned_and_contiguous) {
+  omp::soa_vector<std::int8_t, float, double> records(100);
+
+  const auto address = [](const void *data) {
+    return reinterpret_cast<std::uintptr_t>(data);
+  };
+
+  ASSERT_EQ(address(records.column<0>().data()) % 64, 0u);
+  ASSERT_EQ(address(records.column<1>().data()) % 64, 0u);
+  ASSERT_EQ(address(records.column<2>().data()) % 64, 0u);
+
+  auto floats = records.column<1>();
+
+  std::iota(std::begin(floats), std::end(floats), 0.0f);
+
+  ASSERT_EQ(std::accumulate(std::begin(floats), std::end(floats), 0.0f),
+            4950.0f);
+}
+
+TEST(omp_soa_vector, reserve_resize_clear) {
+  omp::soa_vector<int, double> records;
+
+  records.reserve(50);
+
+  ASSERT_GE(records.capacity(), 50u);
+  ASSERT_TRUE(records.empty());
+
+  records.resize(10, 7, 0.5);
+
+  ASSERT_EQ(records.size(), 10u);
+  ASSERT_EQ(records.column<0>()[9], 7);
+  ASSERT_EQ(records.column<1>()[9], 0.5);
+
+  records.resize(4);
+
+  ASSERT_EQ(records.column<1>().size(), 4u);
+
+  records.clear();
+
+  ASSERT_TRUE(records.empty());
+}
+
+TEST(omp_soa_vector, iterate_and_sort_records) {
+  omp::soa_vector<int, std::string> records;
+
+  records.push_back(3, "c");
+  records.push_back(1, "a");
+  records.push_back(2, "b");
+
+  std::sort(std::begin(records), std::end(records));
+
+  std::string names;
+
+  for (const auto &[key, name] : std::as_const(records)) {
+    ASSERT_EQ(key, name[0] - 'a' + 1);
+    names += name;
+  }
+
+  ASSERT_EQ(names, "abc");
+
+  omp::soa_vector<int, std::string>::value_type record = records[0];
+
+  records.push_back(record);
+  records.push_back(std::move(record));
+
+  ASSERT_EQ(records.size(), 5u);
+  ASSERT_EQ(records.column<1>()[4], "a");
+}
+
+namespace {
+struct throwing_field {
+  // Default constructions and copies allowed before one throws, no limit
+  // when negative.
+  static inline int budget = -1;
+
+  throwing_field() { spend_(); }
+
+  throwing_field(int value) {
+    if (value < 0)
+      throw std::runtime_error("negative");
+  }
+
+  throwing_field(const throwing_field &) { spend_(); }
+
+  throwing_field &operator=(const throwing_field &) = default;
+
+private:
+  static void spend_() {
+    if (budget == 0)
+      throw std::runtime_error("out of budget");
+
+    if (budget > 0)
+      --budget;
+  }
+};
+} // namespace
+
+TEST(omp_soa_vector, emplace_back_keeps_columns_in_sync) {
+  omp::soa_vector<int, throwing_field> records;
+
+  records.emplace_back(1, 1);
+
+  ASSERT_THROW(records.emplace_back(2, -1), std::runtime_error);
+  ASSERT_EQ(records.size(), 1u);
+  ASSERT_EQ(records.column<1>().size(), 1u);
+}
+
+TEST(omp_soa_vector, resize_keeps_columns_in_sync) {
+  omp::soa_vector<int, throwing_field> records;
+
+  records.emplace_back(1, 1);
+
+  throwing_field::budget = 3;
+  ASSERT_THROW(records.resize(10), std::runtime_error);
+
+  throwing_field::budget = 3;
+  ASSERT_THROW(records.resize(10, 7, throwing_field(1)), std::runtime_error);
+
+  throwing_field::budget = -1;
+
+  ASSERT_EQ(records.size(), 1u);
+  ASSERT_EQ(records.column<0>().size(), 1u);
+  ASSERT_EQ(records.column<1>().size(), 1u);
+  ASSERT_EQ(std::distance(std::cbegin(records), std::cend(records)), 1);
+
+  records.resize(4);
+
+  ASSERT_EQ(records.column<0>().size(), 4u);
+  ASSERT_EQ(records.column<1>().size(), 4u);
+}
+
+namespace {
+struct sample {
+  float value;
+  std::int8_t channel;
+  std::string label;
+};
+} // namespace
+
+TEST(omp_soa_vector, aos_to_soa_and_back) {
+  std::vector<sample> samples;
+
+  for (int i = 0; i < 1000; ++i)
+    samples.push_back({i * 0.5f, static_cast<std::int8_t>(i % 4),
+                       std::to_string(i)});
+
+  auto soa = omp::aos_to_soa(samples);
+
+  using soa_type = omp::soa_vector<float, std::int8_t, std::string>;
+
+  static_assert(std::is_same_v<decltype(soa), soa_type>);
+
+  ASSERT_EQ(soa.size(), samples.size());
+  ASSERT_EQ(soa.column<0>()[999], 499.5f);
+  ASSERT_EQ(soa.column<1>()[999], 3);
+  ASSERT_EQ(soa.column<2>()[999], "999");
+  ASSERT_EQ(samples[999].label, "999");
+
+  auto records = omp::soa_to_aos<sample>(soa);
+
+  ASSERT_EQ(records.size(), samples.size());
+
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    ASSERT_EQ(records[i].value, samples[i].value);
+    ASSERT_EQ(records[i].channel, samples[i].channel);
+    ASSERT_EQ(records[i].label, samples[i].label);
+  }
+}
+
+TEST(omp_soa_vector, aos_to_soa_moves_rvalues) {
+  std::vector<sample> samples = {{1.0f, 1, std::string(100, 'a')},
+                                 {2.0f, 2, std::string(100, 'b')}};
+
+  auto soa = omp::aos_to_soa(std::move(samples));
+
+  ASSERT_EQ(soa.column<2>()[1], std::string(100, 'b'));
+
+  auto records = omp::soa_to_aos<sample>(std::move(soa));
+
+  ASSERT_EQ(records[0].label, std::string(100, 'a'));
+  ASSERT_EQ(records[1].value, 2.0f);
+
+  const sample array[] = {{3.0f, 3, "c"}};
+
+  ASSERT_EQ(omp::aos_to_soa(array).column<2>()[0], "c");
+}
@@ -0,0 +1,106 @@
+#include "omp/utils/static_range.h"
+#include "omp/utils/tuple_map_reduce.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+TEST(omp_static_range, size) {
+  ASSERT_EQ((omp::static_range<0, 4>::size()), 4u);
+  ASSERT_EQ((omp::static_range<3, 7>::size()), 4u);
+  ASSERT_TRUE((omp::static_range<5, 5>::empty()));
+  ASSERT_EQ((std::tuple_size_v<omp::static_range<2, 5>>), 3u);
+}
+
+TEST(omp_static_range, for_each_order) {
+  const std::vector<std::size_t> expecting = {2, 3, 4, 5};
+
+  std::vector<std::size_t> result;
+
+  omp::static_range<2, 6>::for_each(
+      [&](auto idx) { result.emplace_back(idx); });
+
+  ASSERT_EQ(result, expecting);
+}
+
+TEST(omp_static_range, for_each_empty) {
+  std::size_t calls = 0;
+
+  omp::static_range<3, 3>::for_each([&](auto) { ++calls; });
+
+  ASSERT_EQ(calls, 0u);
+}
+
+TEST(omp_static_range, integral_constant_indices) {
+  auto tup = std::make_tuple(1, 2.0, 'c');
+
+  omp::static_range<0, 3>::for_each([&](auto idx) {
+    using index_type = decltype(idx);
+
+    static_assert(std::is_same_v<
+                  index_type, std::integral_constant<std::size_t, idx.value>>);
+
+    std::get<idx>(tup) += 1;
+  });
+
+  ASSERT_EQ(tup, std::make_tuple(2, 3.0, 'd'));
+}
+
+namespace {
+constexpr std::size_t trace_4x4() {
+  std::array<std::array<std::size_t, 4>, 4> matrix{};
+
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      matrix[i][j] = i * 4 + j;
+
+  std::size_t trace = 0;
+
+  omp::static_range<0, 4>::for_each(
+      [&](auto idx) { trace += std::get<idx>(matrix)[idx]; });
+
+  return trace;
+}
+} // namespace
+
+TEST(omp_static_range, constexpr_for_each) {
+  static_assert(trace_4x4() == 0 + 5 + 10 + 15);
+
+  ASSERT_EQ(trace_4x4(), 30u);
+}
+
+TEST(omp_static_range, structured_bindings) {
+  auto [a, b, c] = omp::static_range<4, 7>();
+
+  ASSERT_EQ(a, 4u);
+  ASSERT_EQ(b, 5u);
+  ASSERT_EQ(c, 6u);
+
+  auto c_is_constant =
+      std::is_same_v<std::integral_constant<std::size_t, 6>, decltype(c)>;
+
+  ASSERT_TRUE(c_is_constant);
+}
+
+TEST(omp_static_range, tuple_map) {
+  auto values = std::make_tuple(10, 20.5, 30);
+
+  auto result = omp::tuple_map(
+      [](auto idx, const auto &value) { return value * (idx + 1); },
+      omp::static_range<0, 3>(), values);
+
+  ASSERT_EQ(result, std::make_tuple(10, 41.0, 90));
+}
+
+TEST(omp_static_range, tuple_reduce) {
+  auto values = std::make_tuple(1, 2, 3, 4);
+
+  auto result = omp::tuple_reduce(
+      [](auto sum, auto idx, const auto &value) { return sum + idx * value; },
+      std::size_t{0}, omp::static_range<0, 4>(), values);
+
+  ASSERT_EQ(result, 0u * 1 + 1 * 2 + 2 * 3 + 3 * 4);
+}
@@ -0,0 +1,90 @@
+#include "omp/utils/thread_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(omp_thread_pool, size) {
+  omp::thread_pool pool(3);
+
+  ASSERT_EQ(pool.size(), 3u);
+  ASSERT_FALSE(pool.in_worker());
+
+  omp::thread_pool single(0);
+
+  ASSERT_EQ(single.size(), 1u);
+}
+
+TEST(omp_thread_pool, run_in_worker) {
+  omp::thread_pool pool(2);
+
+  bool in_worker = false;
+
+  pool.run([&] { in_worker = pool.in_worker(); });
+
+  ASSERT_TRUE(in_worker);
+}
+
+TEST(omp_thread_pool, run_rethrows) {
+  omp::thread_pool pool(2);
+
+  ASSERT_THROW(pool.run([] { throw std::runtime_error("failure"); }),
+               std::runtime_error);
+}
+
+TEST(omp_thread_pool, submitted_tasks_complete) {
+  omp::thread_pool pool(4);
+
+  constexpr std::size_t count = 1000;
+
+  std::vector<std::atomic<bool>> done(count);
+  std::atomic<std::size_t> executed{0};
+
+  pool.run([&] {
+    for (std::size_t i = 0; i < count; ++i)
+      pool.submit([&, i] {
+        ++executed;
+        done[i].store(true, std::memory_order_release);
+      });
+
+    for (auto &flag : done)
+      pool.wait(flag);
+  });
+
+  ASSERT_EQ(executed.load(), count);
+}
+
+TEST(omp_thread_pool, tasks_are_stolen) {
+  omp::thread_pool pool(4);
+
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+
+  constexpr std::size_t count = 64;
+
+  std::vector<std::atomic<bool>> done(count);
+
+  pool.run([&] {
+    for (std::size_t i = 0; i < count; ++i)
+      pool.submit([&, i] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          threads.insert(std::this_thread::get_id());
+        }
+
+        done[i].store(true, std::memory_order_release);
+      });
+
+    for (auto &flag : done)
+      pool.wait(flag);
+  });
+
+  ASSERT_GT(threads.size(), 1u);
+}
@@ -4,7 +4,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <functional>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 TEST(omp_tuple_map_tuple, one_tuple) {
   auto initial = std::make_tuple(1, 2.0, 'a', 4, 5);
@@ -335,3 +339,272 @@ TEST(constexpr_context, omp_tuple_map) {
       t;
   ASSERT_EQ(t.max_size(), 9);
 }
+
+TEST(omp_tuple_any, stops_at_first_match) {
+  auto values = std::make_tuple(1, 2.0, 3, 'a');
+  int calls = 0;
+
+  auto result = omp::tuple_any(
+      [&calls](const auto &value) {
+        ++calls;
+        return value == 2;
+      },
+      values);
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(calls, 2);
+
+  calls = 0;
+
+  ASSERT_FALSE(omp::tuple_any(
+      [&calls](const auto &value) {
+        ++calls;
+        return value < 0;
+      },
+      values));
+  ASSERT_EQ(calls, 4);
+}
+
+TEST(omp_tuple_any, multiple_tuples) {
+  auto lhs = std::array{1, 2, 3};
+  auto rhs = std::make_tuple(4, 2, 6);
+
+  ASSERT_TRUE(omp::tuple_any(std::equal_to<>(), lhs, rhs));
+  ASSERT_FALSE(omp::tuple_any(std::greater<>(), lhs, rhs));
+}
+
+TEST(omp_tuple_all, stops_at_first_mismatch) {
+  auto values = std::make_tuple(1, 2.0, -3, 'a');
+  int calls = 0;
+
+  auto result = omp::tuple_all(
+      [&calls](const auto &value) {
+        ++calls;
+        return value > 0;
+      },
+      values);
+
+  ASSERT_FALSE(result);
+  ASSERT_EQ(calls, 3);
+
+  ASSERT_TRUE(omp::tuple_all(std::less<>(), std::pair(1, 2),
+                             std::array{2, 3}));
+}
+
+TEST(omp_tuple_reduce_until, stops_when_done) {
+  auto values = std::array{1, 2, 3, 4, 5};
+  int calls = 0;
+
+  auto result = omp::tuple_reduce_until(
+      [&calls](int accum, int value) {
+        ++calls;
+        return accum + value;
+      },
+      [](int accum) { return accum > 5; }, 0, values);
+
+  ASSERT_EQ(result, 6);
+  ASSERT_EQ(calls, 3);
+
+  calls = 0;
+
+  result = omp::tuple_reduce_until(
+      [&calls](int accum, int value) {
+        ++calls;
+        return accum + value;
+      },
+      [](int accum) { return accum > 5; }, 10, values);
+
+  ASSERT_EQ(result, 10);
+  ASSERT_EQ(calls, 0);
+
+  result = omp::tuple_reduce_until(
+      std::plus<>(), [](int) { return false; }, 0, values);
+
+  ASSERT_EQ(result, 15);
+}
+
+TEST(constexpr_context, omp_tuple_any_all) {
+  static_assert(omp::tuple_any([](int value) { return value == 3; },
+                               std::make_tuple(1, 2, 3)));
+  static_assert(!omp::tuple_all([](int value) { return value < 3; },
+                                std::make_tuple(1, 2, 3)));
+
+  constexpr auto above_one = [](int value) { return value > 1; };
+
+  std::array<int, omp::tuple_reduce_until(DummyFunctorAgain(), above_one, 1,
+                                          std::make_tuple(1, 2, 3))>
+      t;
+  ASSERT_EQ(t.max_size(), 2);
+}
+
+TEST(omp_tuple_for_each, mutates_in_place) {
+  auto values = std::make_tuple(1, 2.5, 'a');
+
+  omp::tuple_for_each([](auto &value) { ++value; }, values);
+
+  ASSERT_EQ(values, std::make_tuple(2, 3.5, 'b'));
+
+  auto sums = std::array{0, 0};
+
+  omp::tuple_for_each([](int &sum, int lhs, int rhs) { sum = lhs + rhs; },
+                      sums, std::pair(1, 2), std::make_tuple(3, 4));
+
+  ASSERT_EQ(sums, (std::array{4, 6}));
+}
+
+TEST(omp_tuple_for_each, in_order) {
+  std::vector<int> visited;
+
+  omp::tuple_for_each([&visited](int value) { visited.push_back(value); },
+                      std::make_tuple(3, 1, 2));
+
+  ASSERT_EQ(visited, std::vector<int>({3, 1, 2}));
+}
+
+TEST(omp_tuple_for_each_indexed, passes_positions) {
+  auto values = std::make_tuple(10, 20.0, 30);
+  std::array<std::size_t, 3> positions{};
+
+  omp::tuple_for_each_indexed(
+      [&positions](auto idx, auto &value) {
+        positions[idx] = idx;
+        value += decltype(idx)::value;
+      },
+      values);
+
+  ASSERT_EQ(values, std::make_tuple(10, 21.0, 32));
+  ASSERT_EQ(positions, (std::array<std::size_t, 3>{0, 1, 2}));
+}
+
+TEST(omp_tuple_for_each, noexcept_propagation) {
+  auto values = std::make_tuple(1, 2);
+
+  const auto safe = [](int &value) noexcept { ++value; };
+  const auto unsafe = [](int &value) { ++value; };
+
+  static_assert(noexcept(omp::tuple_for_each(safe, values)));
+  static_assert(!noexcept(omp::tuple_for_each(unsafe, values)));
+  const auto indexed = [](auto, int &value) noexcept { ++value; };
+
+  static_assert(noexcept(omp::tuple_for_each_indexed(indexed, values)));
+
+  omp::tuple_for_each(safe, values);
+
+  ASSERT_EQ(values, std::make_tuple(2, 3));
+}
+
+namespace {
+constexpr int constexpr_for_each_sum() {
+  auto values = std::array{1, 2, 3};
+  int sum = 0;
+
+  omp::tuple_for_each([&sum](int value) { sum += value; }, values);
+  omp::tuple_for_each_indexed(
+      [&sum](auto idx, int value) { sum += int(idx) * value; }, values);
+
+  return sum;
+}
+} // namespace
+
+TEST(constexpr_context, omp_tuple_for_each) {
+  std::array<int, constexpr_for_each_sum()> t;
+  ASSERT_EQ(t.max_size(), 6 + 8);
+}
+
+TEST(omp_tuple_reduce_tree, balanced_shape) {
+  const auto join = [](const std::string &lhs, const std::string &rhs) {
+    return "(" + lhs + rhs + ")";
+  };
+
+  auto leaves = std::array<std::string, 5>{"a", "b", "c", "d", "e"};
+
+  ASSERT_EQ(omp::tuple_reduce_tree(join, leaves), "((ab)(c(de)))");
+  ASSERT_EQ(omp::tuple_reduce_tree(join, std::make_tuple(std::string("a"))),
+            "a");
+}
+
+TEST(omp_tuple_reduce_tree, different_types) {
+  auto result = omp::tuple_reduce_tree(
+      [](auto lhs, auto rhs) { return lhs + rhs; },
+      std::make_tuple(1, 2.5, 'a', 4u));
+
+  static_assert(std::is_same_v<decltype(result), double>);
+
+  ASSERT_EQ(result, 1 + 2.5 + 'a' + 4u);
+}
+
+TEST(omp_tuple_reduce_tree, smaller_rounding_error) {
+  std::array<float, 64> values;
+  values.fill(0.1f);
+
+  const auto exact = 64 * static_cast<double>(0.1f);
+
+  const auto folded = omp::tuple_reduce(std::plus<>(), 0.0f, values);
+  const auto tree = omp::tuple_reduce_tree(std::plus<>(), values);
+
+  ASSERT_LE(std::abs(tree - exact), std::abs(folded - exact));
+  ASSERT_NEAR(tree, exact, 1e-6);
+}
+
+TEST(constexpr_context, omp_tuple_reduce_tree) {
+  std::array<int, omp::tuple_reduce_tree(DummyFunctorAgain(),
+                                         std::make_tuple(1, 2, 3))>
+      t;
+  ASSERT_EQ(t.max_size(), 6);
+}
+
+namespace {
+struct point {
+  double x;
+  double y;
+};
+
+struct particle {
+  point position;
+  float mass;
+  int id;
+  std::string name;
+};
+
+struct empty_record {};
+} // namespace
+
+TEST(omp_fields, field_count) {
+  static_assert(omp::field_count_v<point> == 2);
+  static_assert(omp::field_count_v<particle> == 4);
+  static_assert(omp::field_count_v<empty_record> == 0);
+  static_assert(omp::field_count_v<std::pair<int, int>> == 0);
+}
+
+TEST(omp_fields, tuple_algorithms_over_structs) {
+  particle item{{1.0, 2.0}, 3.5f, 7, "seven"};
+
+  auto refs = omp::fields(item);
+
+  using refs_type = std::tuple<point &, float &, int &, std::string &>;
+
+  static_assert(std::is_same_v<decltype(refs), refs_type>);
+
+  std::get<3>(refs) += "!";
+
+  ASSERT_EQ(item.name, "seven!");
+
+  const point origin{0.5, 1.5};
+
+  auto sum = omp::tuple_reduce(std::plus<>(), 0.0, omp::fields(origin));
+
+  ASSERT_EQ(sum, 2.0);
+
+  point scaled = origin;
+
+  omp::tuple_for_each([](double &value, double factor) { value *= factor; },
+                      omp::fields(scaled), std::make_pair(2.0, 3.0));
+
+  ASSERT_EQ(scaled.x, 1.0);
+  ASSERT_EQ(scaled.y, 4.5);
+
+  auto doubled = omp::tuple_map([](double value) { return value * 2; },
+                                omp::fields(origin));
+
+  ASSERT_EQ(doubled, std::make_tuple(1.0, 3.0));
+}
@@ -0,0 +1,127 @@
+#include "omp/utils/enumerate.h"
+#include "omp/utils/ndrange.h"
+#include "omp/utils/unzip.h"
+#include "omp/utils/zip.h"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+TEST(omp_unzip, into_vectors) {
+  std::vector<int> numbers(1000);
+  std::iota(numbers.begin(), numbers.end(), 0);
+
+  std::vector<std::string> names;
+
+  for (auto number : numbers)
+    names.push_back(std::to_string(number));
+
+  std::vector<int> out_numbers = {-1};
+  std::deque<std::string> out_names;
+
+  omp::unzip_into(omp::zip(numbers, names), out_numbers, out_names);
+
+  ASSERT_EQ(out_numbers.size(), 1001u);
+  ASSERT_EQ(out_numbers.front(), -1);
+  ASSERT_TRUE(std::equal(numbers.begin(), numbers.end(),
+                         out_numbers.begin() + 1));
+  ASSERT_TRUE(std::equal(names.begin(), names.end(), out_names.begin()));
+
+  // Members referring to the inputs are copied, not moved.
+  ASSERT_EQ(names[999], "999");
+}
+
+TEST(omp_unzip, forward_views) {
+  std::list<int> numbers = {1, 2, 3};
+  std::list<char> letters = {'a', 'b', 'c', 'd'};
+
+  std::vector<int> out_numbers;
+  std::vector<char> out_letters;
+
+  omp::unzip_into(omp::zip(numbers, letters), out_numbers, out_letters);
+
+  ASSERT_EQ(out_numbers, std::vector<int>({1, 2, 3}));
+  ASSERT_EQ(out_letters, std::vector<char>({'a', 'b', 'c'}));
+}
+
+namespace {
+// Stream of records produced on the fly, like the output of a transform.
+struct record_stream {
+  using record = std::tuple<std::unique_ptr<int>, std::string>;
+
+  struct iterator {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = record;
+    using reference = record;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+
+    reference operator*() const {
+      return {std::make_unique<int>(index), std::string(100, 'x')};
+    }
+
+    iterator &operator++() {
+      ++index;
+      return *this;
+    }
+
+    bool operator!=(const iterator &rhs) const { return index != rhs.index; }
+
+    int index;
+  };
+
+  iterator begin() const { return {0}; }
+
+  iterator end() const { return {size}; }
+
+  int size;
+};
+} // namespace
+
+TEST(omp_unzip, moves_owned_members) {
+  std::vector<std::unique_ptr<int>> pointers;
+  std::vector<std::string> names;
+
+  omp::unzip_into(record_stream{300}, pointers, names);
+
+  ASSERT_EQ(pointers.size(), 300u);
+  ASSERT_EQ(*pointers[299], 299);
+  ASSERT_EQ(names[299], std::string(100, 'x'));
+}
+
+TEST(omp_unzip, to_new_containers) {
+  std::vector<double> weights = {0.5, 1.5, 2.5};
+
+  auto [indices, values] = omp::unzip<std::vector>(omp::enumerate(weights));
+
+  static_assert(
+      std::is_same_v<decltype(indices), std::vector<std::ptrdiff_t>>);
+  static_assert(std::is_same_v<decltype(values), std::vector<double>>);
+
+  ASSERT_EQ(indices, std::vector<std::ptrdiff_t>({0, 1, 2}));
+  ASSERT_EQ(values, weights);
+
+  auto [rows, cols] = omp::unzip<std::vector>(omp::ndrange({2, 3}));
+
+  ASSERT_EQ(rows, std::vector<int>({0, 0, 0, 1, 1, 1}));
+  ASSERT_EQ(cols, std::vector<int>({0, 1, 2, 0, 1, 2}));
+}
+
+TEST(omp_unzip, empty) {
+  std::vector<int> lhs;
+  std::vector<int> rhs(5);
+
+  auto [first, second] = omp::unzip<std::vector>(omp::zip(lhs, rhs));
+
+  ASSERT_TRUE(first.empty());
+  ASSERT_TRUE(second.empty());
+}
@@ -1,7 +1,10 @@
 #include "omp/utils/zip.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <list>
 #include <set>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -160,3 +163,149 @@ TEST(omp_zip, diff_types) {
     ASSERT_EQ(s, *(it2++));
   }
 }
+
+TEST(omp_zip, random_access_end_is_shortest) {
+  std::vector<float> out(7);
+  const std::vector<float> lhs = {1, 2, 3, 4, 5};
+  const std::vector<float> rhs = {2, 2, 2, 2, 2, 2};
+
+  auto zipped = omp::zip(out, lhs, rhs);
+  auto last = std::end(zipped);
+
+  ASSERT_EQ(std::get<0>(last.iterators()), std::begin(out) + 5);
+  ASSERT_EQ(std::get<1>(last.iterators()), std::end(lhs));
+  ASSERT_EQ(std::get<2>(last.iterators()), std::begin(rhs) + 5);
+
+  for (auto [o, l, r] : zipped)
+    o = l * r;
+
+  const std::vector<float> expecting = {2, 4, 6, 8, 10, 0, 0};
+
+  ASSERT_EQ(out, expecting);
+}
+
+TEST(omp_zip, forward_stops_at_shortest) {
+  std::list<int> first = {1, 2, 3};
+  std::vector<int> second = {4, 5, 6, 7};
+
+  std::vector<int> sums;
+
+  for (auto [f, s] : omp::zip(first, second))
+    sums.emplace_back(f + s);
+
+  const std::vector<int> expecting = {5, 7, 9};
+
+  ASSERT_EQ(sums, expecting);
+}
+
+TEST(omp_zip, direct_iterators_stop_at_shortest) {
+  const std::vector<int> first = {1, 2, 3, 4, 5};
+  const std::vector<int> second = {10, 20, 30};
+
+  auto it = omp::zip_iterator(std::begin(first), std::begin(second));
+  const auto last = omp::zip_iterator(std::end(first), std::end(second));
+
+  std::vector<int> sums;
+
+  for (; it != last; ++it) {
+    auto [f, s] = *it;
+    sums.emplace_back(f + s);
+  }
+
+  const std::vector<int> expecting = {11, 22, 33};
+
+  ASSERT_EQ(sums, expecting);
+  ASSERT_EQ(std::get<0>(it.iterators()), std::begin(first) + 3);
+}
+
+TEST(omp_zip, random_access_iterator) {
+  std::vector keys = {5, 6, 7, 8};
+  std::vector<std::string> names = {"a", "b", "c", "d", "e"};
+
+  auto zipped = omp::zip(keys, names);
+
+  using category = typename decltype(zipped)::iterator::iterator_category;
+
+  ASSERT_TRUE((std::is_same_v<category, std::random_access_iterator_tag>));
+
+  auto first = std::begin(zipped);
+  auto last = std::end(zipped);
+
+  ASSERT_EQ(last - first, 4);
+  ASSERT_EQ(std::get<0>(first[2]), 7);
+  ASSERT_EQ(std::get<1>(*(last - 1)), "d");
+  ASSERT_TRUE(first + 4 == last);
+  ASSERT_TRUE(first < last);
+
+  auto [key, name] = *(first + 1);
+
+  key = 60;
+  name = "bb";
+
+  ASSERT_EQ(keys[1], 60);
+  ASSERT_EQ(names[1], "bb");
+}
+
+TEST(omp_zip, sort_columns_together) {
+  std::vector keys = {3, 1, 4, 1, 5, 9, 2, 6};
+  std::vector<std::string> values = {"c", "a", "d", "b", "e", "i", "bb", "f"};
+
+  auto zipped = omp::zip(keys, values);
+
+  std::sort(std::begin(zipped), std::end(zipped));
+
+  const std::vector expecting_keys = {1, 1, 2, 3, 4, 5, 6, 9};
+  const std::vector<std::string> expecting_values = {"a", "b", "bb", "c",
+                                                     "d", "e", "f",  "i"};
+
+  ASSERT_EQ(keys, expecting_keys);
+  ASSERT_EQ(values, expecting_values);
+}
+
+TEST(omp_zip, stable_sort_by_key) {
+  std::vector<int> keys(1000);
+  std::vector<int> order(1000);
+
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>((i * 7919) % 13);
+    order[i] = static_cast<int>(i);
+  }
+
+  auto zipped = omp::zip(keys, order);
+
+  std::stable_sort(std::begin(zipped), std::end(zipped),
+                   [](const auto &lhs, const auto &rhs) {
+                     return std::get<0>(lhs) < std::get<0>(rhs);
+                   });
+
+  for (std::size_t i = 1; i < keys.size(); ++i) {
+    ASSERT_LE(keys[i - 1], keys[i]);
+
+    if (keys[i - 1] == keys[i]) {
+      ASSERT_LT(order[i - 1], order[i]);
+    }
+  }
+}
+
+TEST(omp_zip, swap_and_move_values) {
+  std::vector<std::string> first = {"x", "y"};
+  std::vector second = {1, 2};
+
+  auto zipped = omp::zip(first, second);
+  auto begin = std::begin(zipped);
+
+  std::iter_swap(begin, begin + 1);
+
+  ASSERT_EQ(first[0], "y");
+  ASSERT_EQ(second[0], 2);
+
+  typename decltype(zipped)::value_type value = std::move(*begin);
+
+  ASSERT_EQ(std::get<0>(value), "y");
+  ASSERT_TRUE(first[0].empty());
+
+  *begin = std::move(value);
+
+  ASSERT_EQ(first[0], "y");
+  ASSERT_EQ(second[0], 2);
+}